@@ -6,21 +6,37 @@
 #include <Helena/Logging/FileLogger.hpp>
 #include <Helena/Traits/Conditional.hpp>
 #include <Helena/Traits/Constructible.hpp>
+#include <Helena/Traits/Cacheline.hpp>
 #include <Helena/Traits/Function.hpp>
+#include <Helena/Traits/NameOf.hpp>
+#include <Helena/Traits/UniqueTypes.hpp>
 #include <Helena/Types/Any.hpp>
 #include <Helena/Types/CompressedPair.hpp>
+#include <Helena/Types/EntityRegistry.hpp>
 #include <Helena/Types/Function.hpp>
+#include <Helena/Types/Histogram.hpp>
+#include <Helena/Types/JobSystem.hpp>
 #include <Helena/Types/VectorAny.hpp>
+#include <Helena/Types/VectorPaged.hpp>
 #include <Helena/Types/VectorUnique.hpp>
 #include <Helena/Types/LocationString.hpp>
+#include <Helena/Types/Spinlock.hpp>
+#include <Helena/Types/Tracer.hpp>
 #include <Helena/Util/Process.hpp>
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cstring>
 #include <exception>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 namespace Helena
 {
@@ -42,12 +58,20 @@ namespace Helena
         //! Unique key for storage messages type index
         using UKMessages    = IUniqueKey<3>;
 
-        template <typename T>
-        using EventsPool    = std::vector<T>;
+        //! Unique key for storage dispatch plans type index
+        using UKDispatch    = IUniqueKey<4>;
+
+        //! Unique key for storage deferred events type index
+        using UKDeferred    = IUniqueKey<5>;
 
-        using DeferredCtx   = Types::Any<46>;
-        using DeferredPool  = EventsPool<Types::CompressedPair<DeferredCtx, void(*)(DeferredCtx&)>>;
+        //! Unique key for storage keyed signals type index
+        using UKKeyed       = IUniqueKey<6>;
 
+        //! Unique key for storage entity components type index
+        using UKEntities    = IUniqueKey<7>;
+
+        template <typename T>
+        using EventsPool    = std::vector<T>;
 
         using CustomLogger  = std::unique_ptr<void, void (*)(const void*)>;
 
@@ -56,6 +80,20 @@ namespace Helena
             typename Traits::Function<decltype(Fn)>::Class;
         };
 
+        //! Listener that takes the batch of events: void(std::span<Event>)
+        template <typename Event, auto Fn>
+        static constexpr bool SpanCallback = []() {
+            if constexpr(std::is_empty_v<Event>) {
+                return false;
+            } else if constexpr(std::is_member_function_pointer_v<decltype(Fn)>) {
+                if constexpr(NotTemplateFunction<Fn>) {
+                    return std::is_invocable_v<decltype(Fn), typename Traits::Function<decltype(Fn)>::Class&, std::span<Event>>;
+                } return false;
+            } else {
+                return std::is_invocable_v<decltype(Fn), std::span<Event>>;
+            }
+        }();
+
         template <typename Event, auto Fn, bool Member>
         static constexpr auto RequiresCallback = []() {
             if constexpr(std::is_empty_v<Event>) {
@@ -63,10 +101,11 @@ namespace Helena
                     return Traits::Function<decltype(Fn)>::Orphan;
                 } return false;
             } else if constexpr(!Member && std::is_member_function_pointer_v<decltype(Fn)> == Member) {
-                return std::is_invocable_v<decltype(Fn), Event>;
+                return std::is_invocable_v<decltype(Fn), Event> || SpanCallback<Event, Fn>;
             } else if constexpr(Member && std::is_member_function_pointer_v<decltype(Fn)> == Member) {
                 if constexpr(NotTemplateFunction<Fn>) {
-                    return std::is_invocable_v<decltype(Fn), typename Traits::Function<decltype(Fn)>::Class&, Event&>;
+                    return std::is_invocable_v<decltype(Fn), typename Traits::Function<decltype(Fn)>::Class&, Event&>
+                        || SpanCallback<Event, Fn>;
                 } return false;
             } return false;
         }() && Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
@@ -77,12 +116,104 @@ namespace Helena
             std::invocable<decltype(T::Sleep)> &&
             std::convertible_to<decltype(T::Accumulate), std::uint32_t>;
 
+        //! Component of the view as passed to the callbacks (see: EntityView::Each)
+        template <typename View, typename T>
+        using ViewComponent = decltype(std::declval<const View&>().template Get<T>(std::declval<Types::Entity>()));
+
+        //! Callback of ParallelEach, optionally takes the scratch memory and the entity
+        template <typename Callback, typename View, typename... T>
+        static constexpr bool RequiresParallelCallback =
+            std::invocable<Callback&, Types::Entity, ViewComponent<View, T>...> ||
+            std::invocable<Callback&, ViewComponent<View, T>...> ||
+            std::invocable<Callback&, Types::IMemoryResource*, Types::Entity, ViewComponent<View, T>...> ||
+            std::invocable<Callback&, Types::IMemoryResource*, ViewComponent<View, T>...>;
+
+        //! Hashes of types that the listener reads and writes (see: Engine::Reads, Engine::Writes)
+        struct AccessInfo {
+            const std::uint64_t* m_Reads;
+            std::size_t m_ReadsSize;
+            const std::uint64_t* m_Writes;
+            std::size_t m_WritesSize;
+        };
+
+    #if defined(HELENA_ENGINE_PROFILER)
+    public:
+        //! Dispatch statistics of the listener (Event, Callback), time in nanoseconds
+        class ListenerProfile
+        {
+            friend class Engine;
+
+        public:
+            ListenerProfile(const char* event, const char* listener) noexcept
+                : m_Event{event}
+                , m_Listener{listener}
+                , m_Histogram{}
+                , m_Lock{} {}
+            ~ListenerProfile() = default;
+            ListenerProfile(const ListenerProfile&) = delete;
+            ListenerProfile(ListenerProfile&&) noexcept = delete;
+            ListenerProfile& operator=(const ListenerProfile&) = delete;
+            ListenerProfile& operator=(ListenerProfile&&) noexcept = delete;
+
+            [[nodiscard]] std::string_view GetEvent() const noexcept {
+                return m_Event;
+            }
+
+            [[nodiscard]] std::string_view GetListener() const noexcept {
+                return m_Listener;
+            }
+
+            [[nodiscard]] std::uint64_t GetCalls() const noexcept {
+                return m_Histogram.Count();
+            }
+
+            [[nodiscard]] std::uint64_t GetTime() const noexcept {
+                return m_Histogram.Sum();
+            }
+
+            [[nodiscard]] const Types::Histogram<>& GetHistogram() const noexcept {
+                return m_Histogram;
+            }
+
+        private:
+            void Record(std::uint64_t time) noexcept {
+                const std::lock_guard lock{m_Lock};
+                m_Histogram.Add(time);
+            }
+
+        private:
+            const char* m_Event;
+            const char* m_Listener;
+            Types::Histogram<> m_Histogram;
+            Types::Spinlock m_Lock;
+        };
+
+    private:
+    #endif // HELENA_ENGINE_PROFILER
+
+        class Listeners;
+
         class Delegate
         {
             template <typename Event, auto Callback>
-            static void Caller([[maybe_unused]] void* instance, void* ev)
+            static void BatchCaller([[maybe_unused]] void* instance, void* events, std::size_t count)
             {
+                const std::span<Event> batch{static_cast<Event*>(events), count};
                 if constexpr(std::is_member_function_pointer_v<decltype(Callback)>) {
+                    HELENA_ASSERT(instance, "Instance is nullptr");
+                    using Class = typename Traits::Function<decltype(Callback)>::Class;
+                    ((*static_cast<Class*>(instance)).*Callback)(batch);
+                } else {
+                    Callback(batch);
+                }
+            }
+
+            template <typename Event, auto Callback>
+            static void Caller([[maybe_unused]] void* instance, void* ev)
+            {
+                if constexpr(SpanCallback<Event, Callback>) {
+                    BatchCaller<Event, Callback>(instance, ev, 1);
+                } else if constexpr(std::is_member_function_pointer_v<decltype(Callback)>) {
                     HELENA_ASSERT(instance, "Instance is nullptr");
                     using Class = typename Traits::Function<decltype(Callback)>::Class;
                     if constexpr(std::is_empty_v<Event>) {
@@ -90,68 +221,931 @@ namespace Helena
                     } else {
                         ((*static_cast<Class*>(instance)).*Callback)(*static_cast<Event*>(ev));
                     }
-                } else {
-                    if constexpr(std::is_empty_v<Event>) {
-                        Callback();
-                    } else {
-                        Callback(*static_cast<Event*>(ev));
+                } else {
+                    if constexpr(std::is_empty_v<Event>) {
+                        Callback();
+                    } else {
+                        Callback(*static_cast<Event*>(ev));
+                    }
+                }
+            }
+
+            using Callback = void (void*, void*);
+            using Batch = void (void*, void*, std::size_t);
+
+            template <typename Event, auto Fn>
+            static constexpr Batch* BatchOf() noexcept
+            {
+                if constexpr(SpanCallback<Event, Fn>) {
+                    return &BatchCaller<Event, Fn>;
+                } else {
+                    return nullptr;
+                }
+            }
+
+        public:
+            template<typename Event, auto Callback>
+            struct Args {};
+
+        public:
+            template<typename Event, auto Fn>
+            Delegate(Args<Event, Fn>, void* instance, const AccessInfo* access = nullptr)
+                : m_Callback{Caller<Event, Fn>}
+                , m_Batch{BatchOf<Event, Fn>()}
+                , m_Instance{instance}
+                , m_Access{access}
+            #if defined(HELENA_TRACER)
+                , m_Name{Traits::NameOf<Args<Event, Fn>>}
+            #endif
+                {}
+            ~Delegate() = default;
+            Delegate(const Delegate&) = default;
+            Delegate(Delegate&&) noexcept = default;
+            Delegate& operator=(const Delegate&) = default;
+            Delegate& operator=(Delegate&&) noexcept = default;
+
+            template <typename... Args>
+            void operator()(Args&&... args) const
+            {
+                HELENA_TRACE_SCOPE(m_Name, "Listener");
+            #if defined(HELENA_ENGINE_PROFILER)
+                if(m_Profile) {
+                    const auto start = std::chrono::steady_clock::now();
+                    m_Callback(m_Instance, std::forward<Args>(args)...);
+                    m_Profile->Record(static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+                    return;
+                }
+            #endif
+                m_Callback(m_Instance, std::forward<Args>(args)...);
+            }
+
+            //! Call the listener with the batch of events, only for span listeners (see: Batched)
+            void operator()(void* events, std::size_t count) const
+            {
+                HELENA_TRACE_SCOPE(m_Name, "Listener");
+            #if defined(HELENA_ENGINE_PROFILER)
+                if(m_Profile) {
+                    const auto start = std::chrono::steady_clock::now();
+                    m_Batch(m_Instance, events, count);
+                    m_Profile->Record(static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+                    return;
+                }
+            #endif
+                m_Batch(m_Instance, events, count);
+            }
+
+            [[nodiscard]] bool Batched() const noexcept {
+                return m_Batch != nullptr;
+            }
+
+            template <typename Event, auto Fn>
+            [[nodiscard]] bool Compare(void* instance = nullptr) const noexcept {
+                return m_Instance == instance && m_Callback == Caller<Event, Fn>;
+            }
+
+            [[nodiscard]] const AccessInfo* Access() const noexcept {
+                return m_Access;
+            }
+
+            [[nodiscard]] explicit operator bool() const noexcept {
+                return m_Callback != nullptr;
+            }
+
+        #if defined(HELENA_ENGINE_PROFILER)
+            void Profile(ListenerProfile* profile) noexcept {
+                m_Profile = profile;
+            }
+        #endif
+
+        private:
+            friend class Listeners;
+
+            //! Empty delegate of the inline buffer of listeners
+            Delegate() noexcept
+                : m_Callback{}
+                , m_Batch{}
+                , m_Instance{}
+                , m_Access{}
+            #if defined(HELENA_TRACER)
+                , m_Name{}
+            #endif
+                {}
+
+            Callback* m_Callback;
+            Batch* m_Batch;
+            void* m_Instance;
+            const AccessInfo* m_Access;
+            std::uint32_t m_Slot{};
+        #if defined(HELENA_ENGINE_PROFILER)
+            ListenerProfile* m_Profile{};
+        #endif
+        #if defined(HELENA_TRACER)
+            const char* m_Name;
+        #endif
+        };
+
+        /**
+        * @brief Listeners of the event
+        * @note Unsubscribed listeners are marked as dead (tombstone) and removed by compaction
+        * when no dispatch of the pool is active, so the indexes stay valid during dispatch.
+        * Listeners subscribed during dispatch are appended and called from the next signal.
+        * The first InlineCapacity delegates are stored in the object itself, so the dispatch of
+        * an event with a few listeners reads one block of memory.
+        */
+        class alignas(Traits::Cacheline) Listeners
+        {
+            struct Slot {
+                std::uint32_t m_Index;
+                std::uint64_t m_Serial;
+            };
+
+            static constexpr std::size_t InlineCapacity = 4;
+
+        public:
+            Listeners() = default;
+            ~Listeners() = default;
+            Listeners(const Listeners&) = delete;
+            Listeners(Listeners&&) noexcept = delete;
+            Listeners& operator=(const Listeners&) = delete;
+            Listeners& operator=(Listeners&&) noexcept = delete;
+
+            [[nodiscard]] std::uint32_t Subscribe(const Delegate& delegate, std::uint64_t serial)
+            {
+                std::uint32_t slot{};
+                if(m_Free.empty()) {
+                    slot = static_cast<std::uint32_t>(m_Slots.size());
+                    m_Slots.emplace_back();
+                } else {
+                    slot = m_Free.back();
+                    m_Free.pop_back();
+                }
+
+                m_Slots[slot] = {m_Count, serial};
+                if(m_Count < InlineCapacity) {
+                    m_Inline[m_Count] = delegate;
+                } else {
+                    m_Overflow.push_back(delegate);
+                }
+
+                At(m_Count++).m_Slot = slot;
+                ++m_Alive;
+                ++m_Revision;
+                return slot;
+            }
+
+            bool Unsubscribe(std::uint32_t slot, std::uint64_t serial)
+            {
+                if(slot >= m_Slots.size() || !serial || m_Slots[slot].m_Serial != serial) {
+                    return false;
+                }
+
+                Kill(m_Slots[slot].m_Index);
+                return true;
+            }
+
+            template <typename Event, auto Callback>
+            bool Unsubscribe(void* instance)
+            {
+                for(std::size_t pos = 0; pos < m_Count; ++pos) {
+                    if(At(pos) && At(pos).template Compare<Event, Callback>(instance)) {
+                        Kill(pos);
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            void Clear()
+            {
+                for(std::size_t pos = 0; pos < m_Count; ++pos)
+                {
+                    if(auto& delegate = At(pos)) {
+                        m_Slots[delegate.m_Slot].m_Serial = 0;
+                        m_Free.push_back(delegate.m_Slot);
+                        delegate.m_Callback = nullptr;
+                        ++m_Dead;
+                    }
+                }
+
+                m_Alive = 0;
+                ++m_Revision;
+
+                if(!m_Locks) {
+                    m_Overflow.clear();
+                    m_Count = 0;
+                    m_Dead = 0;
+                }
+            }
+
+            //! Defer the compaction while the listeners are dispatched
+            void Lock() noexcept {
+                ++m_Locks;
+            }
+
+            void Unlock() noexcept
+            {
+                HELENA_ASSERT(m_Locks, "Listeners are not locked");
+                if(!--m_Locks && m_Dead) {
+                    Compact();
+                }
+            }
+
+            //! Count of slots including dead listeners, used for iteration by index
+            [[nodiscard]] std::size_t Slots() const noexcept {
+                return m_Count;
+            }
+
+            [[nodiscard]] std::size_t Size() const noexcept {
+                return m_Alive;
+            }
+
+            [[nodiscard]] bool Empty() const noexcept {
+                return !m_Alive;
+            }
+
+            [[nodiscard]] std::uint64_t Revision() const noexcept {
+                return m_Revision;
+            }
+
+            [[nodiscard]] bool Locked() const noexcept {
+                return m_Locks != 0;
+            }
+
+            [[nodiscard]] const Delegate& operator[](std::size_t pos) const noexcept {
+                return pos < InlineCapacity ? m_Inline[pos] : m_Overflow[pos - InlineCapacity];
+            }
+
+        private:
+            [[nodiscard]] Delegate& At(std::size_t pos) noexcept {
+                return pos < InlineCapacity ? m_Inline[pos] : m_Overflow[pos - InlineCapacity];
+            }
+
+            void Kill(std::size_t pos)
+            {
+                auto& delegate = At(pos);
+                m_Slots[delegate.m_Slot].m_Serial = 0;
+                m_Free.push_back(delegate.m_Slot);
+                delegate.m_Callback = nullptr;
+                --m_Alive;
+                ++m_Dead;
+                ++m_Revision;
+
+                // Keep the amortized O(1) unsubscribe without dispatch
+                if(!m_Locks && m_Dead * 2 >= m_Count) {
+                    Compact();
+                }
+            }
+
+            void Compact() noexcept
+            {
+                std::size_t alive{};
+                for(std::size_t pos = 0; pos < m_Count; ++pos)
+                {
+                    if(const auto& delegate = At(pos)) {
+                        m_Slots[delegate.m_Slot].m_Index = static_cast<std::uint32_t>(alive);
+                        At(alive++) = delegate;
+                    }
+                }
+
+                const auto overflow = alive > InlineCapacity ? alive - InlineCapacity : 0;
+                m_Overflow.erase(m_Overflow.begin() + static_cast<std::ptrdiff_t>(overflow), m_Overflow.end());
+                m_Count = static_cast<std::uint32_t>(alive);
+                m_Dead = 0;
+                ++m_Revision;
+            }
+
+        private:
+            // Fields read by the dispatch share the cache line with the first delegate
+            std::uint32_t m_Count{};
+            std::uint32_t m_Alive{};
+            std::uint32_t m_Locks{};
+            std::uint32_t m_Dead{};
+            Delegate m_Inline[InlineCapacity];
+            std::vector<Delegate> m_Overflow;
+            std::vector<Slot> m_Slots;
+            std::vector<std::uint32_t> m_Free;
+            std::uint64_t m_Revision{};
+        };
+
+        template <typename...>
+        struct Signals {};
+
+        template <bool Spin>
+        static void SleepUntilDeadline();
+
+        //! Direct call sequence of the systems members for one engine event
+        using StaticDispatcher = void (*)(void* const* systems, void* event);
+
+        //! Count of engine events with static dispatch (PreInit ... PostShutdown)
+        static constexpr std::size_t m_StaticEvents = 24;
+
+        //! Size of the scratch memory on the stack of the chunk of ParallelEach
+        static constexpr std::size_t m_ScratchSize = 4096;
+
+        //! Maximum count of chunks of ParallelEach, bounds the cost of creating and scheduling the jobs of one call
+        static constexpr std::size_t m_MaxChunks = 1024;
+
+        //! Listeners of the event grouped by key, open addressing with linear probing
+        class KeyedListeners
+        {
+            struct Bucket {
+                std::uint64_t m_Key{};
+                std::unique_ptr<Listeners> m_Pool;
+            };
+
+        public:
+            KeyedListeners() = default;
+            ~KeyedListeners() = default;
+            KeyedListeners(const KeyedListeners&) = delete;
+            KeyedListeners(KeyedListeners&&) noexcept = delete;
+            KeyedListeners& operator=(const KeyedListeners&) = delete;
+            KeyedListeners& operator=(KeyedListeners&&) noexcept = delete;
+
+            [[nodiscard]] Listeners* Find(std::uint64_t key) const noexcept
+            {
+                if(!m_Size) {
+                    return nullptr;
+                }
+
+                for(auto pos = Home(key);; pos = (pos + 1) & (m_Buckets.size() - 1))
+                {
+                    const auto& bucket = m_Buckets[pos];
+                    if(!bucket.m_Pool) {
+                        return nullptr;
+                    }
+
+                    if(bucket.m_Key == key) {
+                        return bucket.m_Pool.get();
+                    }
+                }
+            }
+
+            //! Get or create the listeners of the key, the pointers of listeners are stable
+            [[nodiscard]] Listeners& Get(std::uint64_t key)
+            {
+                if(const auto pool = Find(key)) {
+                    return *pool;
+                }
+
+                if((m_Size + 1) * 2 > m_Buckets.size()) {
+                    Rehash((std::max)(m_Buckets.size() * 2, std::size_t{16}));
+                }
+
+                auto pos = Home(key);
+                while(m_Buckets[pos].m_Pool) {
+                    pos = (pos + 1) & (m_Buckets.size() - 1);
+                }
+
+                m_Buckets[pos].m_Key = key;
+                m_Buckets[pos].m_Pool = std::make_unique<Listeners>();
+                ++m_Size;
+                return *m_Buckets[pos].m_Pool;
+            }
+
+            //! Remove the listeners of the key if they are empty and not dispatched
+            void Release(std::uint64_t key)
+            {
+                if(!m_Size) {
+                    return;
+                }
+
+                const auto mask = m_Buckets.size() - 1;
+                auto pos = Home(key);
+                while(m_Buckets[pos].m_Pool && m_Buckets[pos].m_Key != key) {
+                    pos = (pos + 1) & mask;
+                }
+
+                if(!m_Buckets[pos].m_Pool || !m_Buckets[pos].m_Pool->Empty() || m_Buckets[pos].m_Pool->Locked()) {
+                    return;
+                }
+
+                // Backward shift deletion keeps the probe sequences without tombstones
+                for(auto next = (pos + 1) & mask; m_Buckets[next].m_Pool; next = (next + 1) & mask)
+                {
+                    const auto home = Home(m_Buckets[next].m_Key);
+                    if(((next - home) & mask) >= ((next - pos) & mask)) {
+                        m_Buckets[pos] = std::move(m_Buckets[next]);
+                        pos = next;
+                    }
+                }
+
+                m_Buckets[pos] = Bucket{};
+                --m_Size;
+            }
+
+        private:
+            [[nodiscard]] std::size_t Home(std::uint64_t key) const noexcept {
+                return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (m_Buckets.size() - 1);
+            }
+
+            void Rehash(std::size_t capacity)
+            {
+                auto buckets = std::exchange(m_Buckets, std::vector<Bucket>(capacity));
+                for(auto& bucket : buckets)
+                {
+                    if(bucket.m_Pool) {
+                        auto pos = Home(bucket.m_Key);
+                        while(m_Buckets[pos].m_Pool) {
+                            pos = (pos + 1) & (capacity - 1);
+                        }
+
+                        m_Buckets[pos] = std::move(bucket);
+                    }
+                }
+            }
+
+        private:
+            std::vector<Bucket> m_Buckets;
+            std::size_t m_Size{};
+        };
+
+        //! Deferred events of one type, the storage is reused between frames
+        class DeferredQueue
+        {
+        public:
+            DeferredQueue() = default;
+            virtual ~DeferredQueue() = default;
+            DeferredQueue(const DeferredQueue&) = delete;
+            DeferredQueue(DeferredQueue&&) noexcept = delete;
+            DeferredQueue& operator=(const DeferredQueue&) = delete;
+            DeferredQueue& operator=(DeferredQueue&&) noexcept = delete;
+
+            //! Move the queued events to the drain buffer, events enqueued while draining wait for the next frame
+            virtual void Swap() noexcept = 0;
+
+            //! Signal the next event of the drain buffer (strict FIFO)
+            virtual void SignalNext() = 0;
+
+            //! Signal the rest of the drain buffer listener by listener
+            virtual void SignalAll() = 0;
+
+            virtual void Clear() noexcept = 0;
+
+        public:
+            bool m_Queued{};
+        };
+
+        template <typename Event>
+        class DeferredEvents final : public DeferredQueue
+        {
+        public:
+            DeferredEvents() = default;
+            ~DeferredEvents() override = default;
+            DeferredEvents(const DeferredEvents&) = delete;
+            DeferredEvents(DeferredEvents&&) noexcept = delete;
+            DeferredEvents& operator=(const DeferredEvents&) = delete;
+            DeferredEvents& operator=(DeferredEvents&&) noexcept = delete;
+
+            template <typename... Args>
+            void Push(Args&&... args);
+
+            void Swap() noexcept override;
+            void SignalNext() override;
+            void SignalAll() override;
+            void Clear() noexcept override;
+
+        private:
+            std::vector<Event> m_Events;
+            std::vector<Event> m_Drain;
+            std::size_t m_Cursor{};
+        };
+
+        /**
+        * @brief Deferred events of one producer thread
+        * @note Single producer, single consumer: the producer appends to the blocks without locks,
+        * the consumer (Heartbeat) reads up to the published count of the block.
+        * The consumed block is kept as spare for the producer.
+        */
+        class ConcurrentQueue
+        {
+            static constexpr std::size_t m_BlockSize = 64;
+
+            using Storage = Types::Any<48>;
+
+            struct Entry {
+                Storage m_Event;
+                void (*m_Enqueue)(Storage&){};
+            };
+
+            struct Block {
+                std::array<Entry, m_BlockSize> m_Entries;
+                std::atomic<std::size_t> m_Count{};
+                std::atomic<Block*> m_Next{};
+            };
+
+        public:
+            ConcurrentQueue() : m_Tail{new Block}, m_Head{m_Tail} {}
+            ~ConcurrentQueue()
+            {
+                while(m_Head) {
+                    delete std::exchange(m_Head, m_Head->m_Next.load(std::memory_order_relaxed));
+                }
+
+                delete m_Spare.load(std::memory_order_relaxed);
+            }
+
+            ConcurrentQueue(const ConcurrentQueue&) = delete;
+            ConcurrentQueue(ConcurrentQueue&&) noexcept = delete;
+            ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+            ConcurrentQueue& operator=(ConcurrentQueue&&) noexcept = delete;
+
+            // ----- [PRODUCER] -----
+            template <typename Event, typename... Args>
+            void Push(Args&&... args);
+
+            // ----- [CONSUMER] -----
+            //! Move the published events to the deferred queues or destroy them
+            void Drain(bool enqueue);
+
+            //! Release the reference of the producer thread or of the context
+            static void Release(ConcurrentQueue* queue) noexcept
+            {
+                if(queue->m_References.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    delete queue;
+                }
+            }
+
+        public:
+            ConcurrentQueue* m_Next{};
+            std::atomic<std::uint32_t> m_References{1};
+            std::atomic<bool> m_Owned{};
+            std::atomic<bool> m_Detached{};
+
+        private:
+            alignas(Traits::Cacheline) Block* m_Tail;
+            std::size_t m_Write{};
+            alignas(Traits::Cacheline) Block* m_Head;
+            std::size_t m_Read{};
+            std::atomic<Block*> m_Spare{};
+        };
+
+        //! Producer queues of the current thread, one per target context
+        struct ConcurrentProducer
+        {
+            struct Target {
+                const void* m_Context;
+                ConcurrentQueue* m_Queue;
+            };
+
+            ConcurrentProducer() = default;
+            ~ConcurrentProducer()
+            {
+                for(const auto& target : m_Targets) {
+                    target.m_Queue->m_Owned.store(false, std::memory_order_release);
+                    ConcurrentQueue::Release(target.m_Queue);
+                }
+            }
+
+            ConcurrentProducer(const ConcurrentProducer&) = delete;
+            ConcurrentProducer(ConcurrentProducer&&) noexcept = delete;
+            ConcurrentProducer& operator=(const ConcurrentProducer&) = delete;
+            ConcurrentProducer& operator=(ConcurrentProducer&&) noexcept = delete;
+
+            std::vector<Target> m_Targets;
+        };
+
+        class MailboxState;
+
+        //! Listeners of the event grouped into waves, listeners inside a wave do not conflict
+        struct DispatchPlan {
+            std::uint64_t m_Revision{};
+            std::vector<std::uint32_t> m_Order;
+            std::vector<std::uint32_t> m_Waves;
+        };
+
+    public:
+        //! Engine states
+        enum class EState : std::uint8_t
+        {
+            Undefined,
+            Init,
+            Shutdown
+        };
+
+        //! Default Heartbeat configuration
+        struct DefaultConfig {
+            static constexpr auto Sleep = Types::Function::BindFront(
+                static_cast<void (*)(const std::uint64_t)>(Util::Process::Sleep), 1 /* msec */);
+            static constexpr auto Accumulate = 5;
+        };
+
+        /**
+        * @brief Heartbeat configuration: sleep until the deadline of the next Update step
+        * @note Lowest CPU usage, the wake up can be late by the timer slack of the OS
+        */
+        struct LowCPUConfig {
+            static constexpr auto Sleep = &Engine::SleepUntilDeadline<false>;
+            static constexpr auto Accumulate = 5;
+        };
+
+        /**
+        * @brief Heartbeat configuration: sleep until shortly before the deadline of the next Update step,
+        * then spin until the deadline
+        * @note Lowest jitter, the spin time is calibrated by the observed oversleep of the OS
+        */
+        struct LowJitterConfig {
+            static constexpr auto Sleep = &Engine::SleepUntilDeadline<true>;
+            static constexpr auto Accumulate = 5;
+        };
+
+        //! Listeners dispatch mode for Tick, Update and Render phases
+        enum class EDispatch : std::uint8_t
+        {
+            Serial,
+            Parallel
+        };
+
+        /**
+        * @brief Drain order of the deferred events (see: EnqueueSignal)
+        * @note Batched: events are grouped by type in order of the first enqueue of the type
+        * in the frame, events of one type keep the enqueue order and each listener receives
+        * the whole batch of the type before the next listener.
+        * Strict: events are signaled one by one in the enqueue order (FIFO).
+        */
+        enum class EDeferred : std::uint8_t
+        {
+            Batched,
+            Strict
+        };
+
+        //! Structure used to do something without throw a signal (event)
+        static constexpr struct {} NoSignal{};
+
+        /**
+        * @brief Handle of the event listener
+        *
+        * @code{.cpp}
+        * auto subscription = Helena::Engine::SubscribeEvent<Helena::Events::Engine::Update, &OnUpdate>();
+        * Helena::Engine::UnsubscribeEvent(subscription);
+        * @endcode
+        *
+        * @note The handle is not owning: the listener is not removed when the handle is destroyed.
+        */
+        class Subscription
+        {
+            friend class Engine;
+
+            Subscription(void (*unsubscribe)(const Subscription&), std::uint32_t slot, std::uint64_t serial, std::uint64_t key = 0) noexcept
+                : m_Unsubscribe{unsubscribe}
+                , m_Slot{slot}
+                , m_Serial{serial}
+                , m_Key{key} {}
+
+        public:
+            Subscription() noexcept = default;
+            ~Subscription() noexcept = default;
+            Subscription(const Subscription&) noexcept = default;
+            Subscription(Subscription&&) noexcept = default;
+            Subscription& operator=(const Subscription&) noexcept = default;
+            Subscription& operator=(Subscription&&) noexcept = default;
+
+            [[nodiscard]] explicit operator bool() const noexcept {
+                return m_Unsubscribe != nullptr;
+            }
+
+        private:
+            void (*m_Unsubscribe)(const Subscription&){};
+            std::uint32_t m_Slot{};
+            std::uint64_t m_Serial{};
+            std::uint64_t m_Key{};
+        };
+
+        /**
+        * @brief Key of the keyed listeners (channel), for example id of entity
+        *
+        * @code{.cpp}
+        * Helena::Engine::SubscribeEvent<Damage, &Unit::OnDamage>(Helena::Engine::Key{unit.m_Id}, &unit);
+        * Helena::Engine::SignalEvent<Damage>(Helena::Engine::Key{unit.m_Id}, 10.f);
+        * @endcode
+        */
+        struct Key
+        {
+            constexpr explicit Key(std::uint64_t value) noexcept : m_Value{value} {}
+            std::uint64_t m_Value;
+        };
+
+        //! List of systems with compile-time dispatch of the engine events (see: Initialize)
+        template <typename... T>
+        struct StaticSystems {};
+
+        //! Systems that must be registered before the system: using Dependencies = DependsOn<...>
+        template <typename... T>
+        struct DependsOn {};
+
+        //! Types (systems, components) that the listener reads
+        template <typename... T>
+        struct Reads {};
+
+        //! Types (systems, components) that the listener writes
+        template <typename... T>
+        struct Writes {};
+
+    private:
+        template <typename, typename>
+        struct Access;
+
+        template <typename... R, typename... W>
+        struct Access<Reads<R...>, Writes<W...>> {
+            static constexpr std::array<std::uint64_t, sizeof...(R)> m_Reads{Types::Hash<std::uint64_t>::template From<R>()...};
+            static constexpr std::array<std::uint64_t, sizeof...(W)> m_Writes{Types::Hash<std::uint64_t>::template From<W>()...};
+            static constexpr AccessInfo m_Info{m_Reads.data(), m_Reads.size(), m_Writes.data(), m_Writes.size()};
+        };
+
+        template <typename T>
+        struct SystemDependencies {
+            using Type = DependsOn<>;
+        };
+
+        template <typename T>
+        requires requires { typename T::Dependencies; }
+        struct SystemDependencies<T> {
+            using Type = typename T::Dependencies;
+        };
+
+        //! Construction waves of the systems, a system is placed after the systems it depends on
+        template <typename... Systems>
+        class SystemsGraph
+        {
+            static constexpr std::size_t Size = sizeof...(Systems);
+
+            template <typename... T>
+            static constexpr auto Keys(DependsOn<T...>) noexcept {
+                return std::array<std::uint64_t, sizeof...(T)>{Types::Hash<std::uint64_t>::template From<T>()...};
+            }
+
+            struct Result {
+                std::array<std::size_t, Size> m_Waves{};
+                std::size_t m_Count{};
+                bool m_Acyclic{};
+            };
+
+            static constexpr Result Build() noexcept
+            {
+                constexpr std::array<std::uint64_t, Size> keys{Types::Hash<std::uint64_t>::template From<Systems>()...};
+                std::array<std::array<bool, Size>, Size> edges{};
+                std::size_t row{};
+
+                ([&edges, &keys, &row]() {
+                    for(const auto key : Keys(typename SystemDependencies<Systems>::Type{})) {
+                        for(std::size_t column = 0; column < Size; ++column) {
+                            edges[row][column] = edges[row][column] || keys[column] == key;
+                        }
+                    }
+                    ++row;
+                }(), ...);
+
+                // Kahn's algorithm by levels: the wave contains systems whose dependencies are placed
+                Result result{};
+                std::array<bool, Size> placed{};
+                std::size_t count{};
+
+                while(count < Size)
+                {
+                    std::array<bool, Size> ready{};
+                    for(std::size_t i = 0; i < Size; ++i) {
+                        ready[i] = !placed[i];
+                        for(std::size_t j = 0; j < Size && ready[i]; ++j) {
+                            ready[i] = !edges[i][j] || placed[j];
+                        }
+                    }
+
+                    const auto before = count;
+                    for(std::size_t i = 0; i < Size; ++i) {
+                        if(ready[i]) {
+                            placed[i] = true;
+                            result.m_Waves[i] = result.m_Count;
+                            ++count;
+                        }
                     }
+
+                    if(count == before) {
+                        return result;
+                    }
+
+                    ++result.m_Count;
                 }
+
+                result.m_Acyclic = true;
+                return result;
             }
 
-            using Callback = void (void*, void*);
+            static constexpr Result m_Result = Build();
 
         public:
-            template<typename Event, auto Callback>
-            struct Args {};
+            static constexpr bool Acyclic = m_Result.m_Acyclic;
+            static constexpr std::size_t Count = m_Result.m_Count;
 
-        public:
-            template<typename Event, auto Fn>
-            Delegate(Args<Event, Fn>, void* instance)
-                : m_Callback{Caller<Event, Fn>}
-                , m_Instance{instance} {}
-            ~Delegate() = default;
-            Delegate(const Delegate&) = default;
-            Delegate(Delegate&&) noexcept = default;
-            Delegate& operator=(const Delegate&) = default;
-            Delegate& operator=(Delegate&&) noexcept = default;
+            template <std::size_t Index>
+            static constexpr std::size_t Wave = m_Result.m_Waves[Index];
 
-            template <typename... Args>
-            void operator()(Args&&... args) const {
-                m_Callback(m_Instance, std::forward<Args>(args)...);
-            }
+            //! Dependency outside of the list must be registered before
+            template <typename T>
+            static constexpr bool External = !(std::is_same_v<T, Systems> || ...);
+        };
 
-            template <typename Event, auto Fn>
-            [[nodiscard]] bool Compare(void* instance = nullptr) const noexcept {
-                return m_Instance == instance && m_Callback == Caller<Event, Fn>;
-            }
+        //! Hooks of the entity registry, components are announced by signals
+        struct EntitySignals {
+            template <typename T>
+            static void Attach(Types::Entity entity);
 
-        private:
-            Callback* m_Callback;
-            void* m_Instance;
+            template <typename T>
+            static void Detach(Types::Entity entity);
         };
 
-        template <typename...>
-        struct Signals {};
-
     public:
-        //! Engine states
-        enum class EState : std::uint8_t
-        {
-            Undefined,
-            Init,
-            Shutdown
+        //! Entities of the context, components are announced by AttachComponent and DetachComponent
+        using EntityRegistry = Types::EntityRegistry<UKEntities, EntitySignals>;
+
+        //! Level of the overload governor (see: Governor)
+        struct GovernorStep {
+            //! Multiplier of the tickrate set by SetTickrate, in range (0, 1]
+            double m_Scale{1.};
+            //! Skip the events of the Render phase
+            bool m_SkipRender{};
         };
 
-        //! Default Heartbeat configuration
-        struct DefaultConfig {
-            static constexpr auto Sleep = Types::Function::BindFront(
-                static_cast<void (*)(const std::uint64_t)>(Util::Process::Sleep), 1 /* msec */);
-            static constexpr auto Accumulate = 5;
+        /**
+        * @brief Policy of the overload governor (see: SetGovernor)
+        * @note The load of a frame is the work time of Heartbeat divided by the tick period.
+        * The frame is overloaded when the load reaches m_Overload or the Accumulate budget is exhausted.
+        * After m_OverloadFrames consecutive overloaded frames the governor moves to the next step.
+        * The previous step is restored after m_RecoverFrames consecutive frames whose load,
+        * scaled to the tickrate of the previous step, stays below m_Recover.
+        */
+        struct Governor {
+            std::vector<GovernorStep> m_Steps{};
+            double m_Overload{0.9};
+            double m_Recover{0.6};
+            std::uint32_t m_OverloadFrames{30};
+            std::uint32_t m_RecoverFrames{120};
         };
 
-        //! Structure used to do something without throw a signal (event)
-        static constexpr struct {} NoSignal{};
+        //! Heartbeat frame statistics, time in nanoseconds
+        class FrameStats
+        {
+            friend class Engine;
+
+        public:
+            FrameStats() noexcept = default;
+            ~FrameStats() noexcept = default;
+            FrameStats(const FrameStats&) noexcept = default;
+            FrameStats(FrameStats&&) noexcept = default;
+            FrameStats& operator=(const FrameStats&) noexcept = default;
+            FrameStats& operator=(FrameStats&&) noexcept = default;
+
+            //! Histogram of time between the beginnings of frames (p50/p95/p99/max)
+            [[nodiscard]] const Types::Histogram<>& GetFrameTime() const noexcept {
+                return m_FrameTime;
+            }
+
+            //! Histogram of count of Update steps per frame
+            [[nodiscard]] const Types::Histogram<>& GetUpdateSteps() const noexcept {
+                return m_UpdateSteps;
+            }
+
+            [[nodiscard]] std::uint64_t GetFrames() const noexcept {
+                return m_UpdateSteps.Count();
+            }
+
+            [[nodiscard]] std::uint64_t GetUpdates() const noexcept {
+                return m_UpdateSteps.Sum();
+            }
+
+            //! Count of frames where the Accumulate budget ran out before the lag was repaid
+            [[nodiscard]] std::uint64_t GetExhausted() const noexcept {
+                return m_Exhausted;
+            }
+
+            //! Accumulated time that has not been consumed by Update steps yet
+            [[nodiscard]] std::uint64_t GetLag() const noexcept {
+                return m_Lag;
+            }
+
+            [[nodiscard]] std::uint64_t GetMaxLag() const noexcept {
+                return m_MaxLag;
+            }
+
+            [[nodiscard]] std::uint64_t GetWorkTime() const noexcept {
+                return m_WorkTime;
+            }
+
+            [[nodiscard]] std::uint64_t GetSleepTime() const noexcept {
+                return m_SleepTime;
+            }
+
+        private:
+            Types::Histogram<> m_FrameTime{};
+            Types::Histogram<> m_UpdateSteps{};
+            std::uint64_t m_FrameBegin{};
+            std::uint64_t m_Exhausted{};
+            std::uint64_t m_Lag{};
+            std::uint64_t m_MaxLag{};
+            std::uint64_t m_WorkTime{};
+            std::uint64_t m_SleepTime{};
+        };
 
         //! Context for storage framework data
         class Context
@@ -162,14 +1156,32 @@ namespace Helena
                 Types::SourceLocation m_Location;
             };
 
-            static constexpr auto m_DefaultTickRate = 1. / 30.;
+            static constexpr std::uint64_t m_DefaultTickRate = 1'000'000'000 / 30;
+            static constexpr std::uint64_t m_DefaultSleepOvershoot = 100'000;
 
         public:
             Context() noexcept
                 : m_Systems{}
                 , m_Components{}
+                , m_Entities{}
                 , m_Signals{}
-                , m_DeferredSignals{}
+                , m_DeferredIndexer{}
+                , m_DeferredQueues{}
+                , m_DeferredOrder{}
+                , m_DeferredSequence{}
+                , m_DeferredDrain{}
+                , m_DeferredDrainSequence{}
+                , m_ConcurrentQueues{}
+                , m_Mailbox{std::make_shared<MailboxState>(this)}
+                , m_KeyedSignals{}
+                , m_SignalsSerial{}
+                , m_SignalsLock{}
+                , m_ConstructingSystems{}
+                , m_DispatchPlans{}
+                , m_Dispatching{}
+                , m_StaticDispatch{}
+                , m_StaticSystems{}
+                , m_Jobs{std::make_unique<Types::JobSystem>()}
                 , m_ShutdownMessage{std::make_unique<ShutdownMessage>()}
                 , m_Logger{new Logging::FileLogger(), +[](const void* ptr) {
                         delete static_cast<const Logging::FileLogger*>(ptr);
@@ -178,12 +1190,33 @@ namespace Helena
                 , m_TimeNow{}
                 , m_TimePrev{}
                 , m_TickRate{m_DefaultTickRate}
+                , m_BaseTickRate{m_DefaultTickRate}
                 , m_TimeDelta{}
-                , m_TimeElapsed{}
-                , m_State{EState::Undefined} {}
+                , m_TimeAccumulator{}
+                , m_SleepOvershoot{m_DefaultSleepOvershoot}
+                , m_FrameStats{}
+                , m_Governor{}
+                , m_GovernorLevel{}
+                , m_GovernorOverloaded{}
+                , m_GovernorHealthy{}
+                , m_GovernorSkipRender{}
+                , m_State{EState::Undefined}
+                , m_Dispatch{EDispatch::Serial}
+                , m_Deferred{EDeferred::Batched} {}
 
             virtual ~Context() {
+                // Wait for the threads posting to the context, the next posts fail
+                m_Mailbox->Close();
+                m_Jobs->Stop();
+
+                for(auto queue = m_ConcurrentQueues.load(std::memory_order_acquire); queue;) {
+                    queue->m_Detached.store(true, std::memory_order_release);
+                    ConcurrentQueue::Release(std::exchange(queue, queue->m_Next));
+                }
+
                 m_Signals.Clear();
+                m_KeyedSignals.Clear();
+                m_Entities.Clear();
                 m_Systems.Clear();
                 m_Components.Clear();
             }
@@ -200,10 +1233,38 @@ namespace Helena
             // Systems and Components
             Types::VectorAny<UKSystems> m_Systems;
             Types::VectorAny<UKComponents> m_Components;
+            EntityRegistry m_Entities;
 
             // Signals
-            Types::VectorUnique<UKSignals, EventsPool<Delegate>> m_Signals;
-            DeferredPool m_DeferredSignals;
+            Types::VectorPaged<UKSignals, Listeners> m_Signals;
+            Types::UniqueIndexer<UKDeferred> m_DeferredIndexer;
+            std::vector<std::unique_ptr<DeferredQueue>> m_DeferredQueues;
+            std::vector<DeferredQueue*> m_DeferredOrder;
+            std::vector<DeferredQueue*> m_DeferredSequence;
+            std::vector<DeferredQueue*> m_DeferredDrain;
+            std::vector<DeferredQueue*> m_DeferredDrainSequence;
+            std::atomic<ConcurrentQueue*> m_ConcurrentQueues;
+            std::shared_ptr<MailboxState> m_Mailbox;
+            Types::VectorUnique<UKKeyed, KeyedListeners> m_KeyedSignals;
+            std::uint64_t m_SignalsSerial;
+            Types::Spinlock m_SignalsLock;
+            bool m_ConstructingSystems;
+
+            // Parallel dispatch
+            Types::VectorUnique<UKDispatch, DispatchPlan> m_DispatchPlans;
+            std::atomic<bool> m_Dispatching;
+
+            // Static dispatch
+            std::array<StaticDispatcher, m_StaticEvents> m_StaticDispatch;
+            std::vector<void*> m_StaticSystems;
+
+            // Jobs
+            std::unique_ptr<Types::JobSystem> m_Jobs;
+
+        #if defined(HELENA_ENGINE_PROFILER)
+            // Listeners statistics
+            std::vector<std::unique_ptr<ListenerProfile>> m_Profiles;
+        #endif
 
             // Reason
             std::unique_ptr<ShutdownMessage> m_ShutdownMessage;
@@ -211,17 +1272,31 @@ namespace Helena
             // Logger
             CustomLogger m_Logger;
 
-            // Timers for Heartbeat
+            // Timers for Heartbeat (monotonic clock, nanoseconds)
             std::uint64_t m_TimeStart;
             std::uint64_t m_TimeNow;
             std::uint64_t m_TimePrev;
 
-            double m_TickRate;
+            std::uint64_t m_TickRate;
+            std::uint64_t m_BaseTickRate;
             double m_TimeDelta;
-            double m_TimeElapsed;
+            std::uint64_t m_TimeAccumulator;
+            std::uint64_t m_SleepOvershoot;
+
+            // Statistics of Heartbeat
+            FrameStats m_FrameStats;
+
+            // Overload governor
+            Governor m_Governor;
+            std::uint32_t m_GovernorLevel;
+            std::uint32_t m_GovernorOverloaded;
+            std::uint32_t m_GovernorHealthy;
+            bool m_GovernorSkipRender;
 
             // Engine state
             std::atomic<EState> m_State;
+            EDispatch m_Dispatch;
+            EDeferred m_Deferred;
 
         #if defined(HELENA_PLATFORM_LINUX)
             // Used on Linux for signal handling;
@@ -234,6 +1309,139 @@ namespace Helena
         using ContextStorage = std::unique_ptr<Context, ContextDeleter>;
         inline static ContextStorage m_Context{nullptr, nullptr};
 
+        //! Context of the shard bound to the current thread, overrides the main context
+        inline static thread_local Context* m_ShardContext{nullptr};
+
+        //! Liveness of the context, shared by the context with its mailboxes
+        class MailboxState
+        {
+        public:
+            explicit MailboxState(Context* context) noexcept : m_Context{context}, m_Posting{}, m_Closed{} {}
+            ~MailboxState() noexcept = default;
+            MailboxState(const MailboxState&) = delete;
+            MailboxState(MailboxState&&) noexcept = delete;
+            MailboxState& operator=(const MailboxState&) = delete;
+            MailboxState& operator=(MailboxState&&) noexcept = delete;
+
+            //! Returns nullptr if the context is destroyed, or the context kept alive until Leave
+            [[nodiscard]] Context* Enter() noexcept
+            {
+                m_Posting.fetch_add(1, std::memory_order_seq_cst);
+                if(m_Closed.load(std::memory_order_seq_cst)) [[unlikely]] {
+                    Leave();
+                    return nullptr;
+                }
+
+                return m_Context;
+            }
+
+            void Leave() noexcept {
+                m_Posting.fetch_sub(1, std::memory_order_release);
+            }
+
+            //! Called by the destructor of the context
+            void Close() noexcept
+            {
+                m_Closed.store(true, std::memory_order_seq_cst);
+                while(m_Posting.load(std::memory_order_acquire)) {
+                    HELENA_PROCESSOR_YIELD();
+                }
+            }
+
+            [[nodiscard]] bool Closed() const noexcept {
+                return m_Closed.load(std::memory_order_acquire);
+            }
+
+        private:
+            Context* m_Context;
+            std::atomic<std::uint32_t> m_Posting;
+            std::atomic<bool> m_Closed;
+        };
+
+    public:
+        /**
+        * @brief Address of the context (engine or shard) for the signals from other threads
+        * @note The mailbox keeps the liveness of the context, not the context:
+        * posting to a destroyed context fails (see: PostSignal)
+        */
+        class Mailbox
+        {
+            friend class Engine;
+
+            explicit Mailbox(std::shared_ptr<MailboxState> state) noexcept : m_State{std::move(state)} {}
+
+        public:
+            Mailbox() noexcept = default;
+            ~Mailbox() noexcept = default;
+            Mailbox(const Mailbox&) noexcept = default;
+            Mailbox(Mailbox&&) noexcept = default;
+            Mailbox& operator=(const Mailbox&) noexcept = default;
+            Mailbox& operator=(Mailbox&&) noexcept = default;
+
+            //! Returns true if the context is alive
+            [[nodiscard]] explicit operator bool() const noexcept {
+                return m_State && !m_State->Closed();
+            }
+
+            [[nodiscard]] bool operator==(const Mailbox&) const noexcept = default;
+
+        private:
+            std::shared_ptr<MailboxState> m_State;
+        };
+
+        /**
+        * @brief Independent engine of the thread (see: CreateShard)
+        * @note The shard owns the context and must be destroyed on its thread
+        */
+        class Shard
+        {
+            friend class Engine;
+
+            explicit Shard(ContextStorage context) noexcept : m_Context{std::move(context)} {}
+
+        public:
+            Shard() noexcept : m_Context{nullptr, nullptr} {}
+            ~Shard() {
+                Reset();
+            }
+
+            Shard(const Shard&) = delete;
+            Shard(Shard&&) noexcept = default;
+            Shard& operator=(const Shard&) = delete;
+            Shard& operator=(Shard&& other) noexcept
+            {
+                if(this != &other) {
+                    Reset();
+                    m_Context = std::move(other.m_Context);
+                }
+
+                return *this;
+            }
+
+            [[nodiscard]] Mailbox GetMailbox() const noexcept {
+                return m_Context ? Mailbox{m_Context->m_Mailbox} : Mailbox{};
+            }
+
+            [[nodiscard]] explicit operator bool() const noexcept {
+                return static_cast<bool>(m_Context);
+            }
+
+        private:
+            void Reset() noexcept
+            {
+                // Systems are destroyed with the bound context, they can use the Engine API
+                const auto context = m_Context.get();
+                m_Context.reset();
+                if(m_ShardContext == context) {
+                    m_ShardContext = nullptr;
+                }
+            }
+
+        private:
+            ContextStorage m_Context;
+        };
+
+    private:
         static void InitContext(ContextStorage context) noexcept;
         [[nodiscard]] static Context& MainContext() noexcept;
 
@@ -248,6 +1456,29 @@ namespace Helena
 
         static void RegisterHandlers();
         [[nodiscard]] static std::uint64_t GetTickTime() noexcept;
+        [[nodiscard]] static bool Conflicts(const AccessInfo* lhs, const AccessInfo* rhs) noexcept;
+        static void BuildDispatchPlan(const Listeners& pool, DispatchPlan& plan);
+        static void StartJobs();
+
+        static void DrainDeferred();
+
+        static void UpdateGovernor(std::uint64_t work, bool exhausted);
+        static void SetGovernorLevel(std::uint32_t level);
+
+        [[nodiscard]] static ConcurrentQueue& GetConcurrentQueue(Context& ctx);
+
+        template <typename Event, typename... Systems>
+        static void StaticDispatch(void* const* systems, void* event);
+
+        template <typename... Systems, typename... Events>
+        static void InstallStaticDispatch(Signals<Events...>);
+
+        template <typename Event, typename... Args>
+        static void StaticSignalEvent(Args&&... args);
+
+    #if defined(HELENA_ENGINE_PROFILER)
+        [[nodiscard]] static ListenerProfile* GetListenerProfile(const char* event, const char* listener);
+    #endif
 
     public:
         /**
@@ -257,55 +1488,266 @@ namespace Helena
         * @param args Arguments for context initialization
         * @note The context can be inherited
         */
-        template <std::derived_from<Engine::Context> T = Context, typename... Args>
-        requires Traits::ConstructibleAggregateFrom<T, Args...>
-        static void Initialize([[maybe_unused]] Args&&... args);
+        template <std::derived_from<Engine::Context> T = Context, typename... Args>
+        requires Traits::ConstructibleAggregateFrom<T, Args...>
+        static void Initialize([[maybe_unused]] Args&&... args);
+
+        /**
+        * @brief Initialize context of Engine with systems of compile-time dispatch
+        *
+        * @code{.cpp}
+        * struct Physics {
+        *     void OnInit() {}
+        *     void OnUpdate(Helena::Events::Engine::Update& event) {}
+        * };
+        *
+        * struct Renderer {
+        *     void OnRender(Helena::Events::Engine::Render& event) {}
+        * };
+        *
+        * Helena::Engine::Initialize(Helena::Engine::StaticSystems<Physics, Renderer>{});
+        * @endcode
+        *
+        * @tparam T Context type
+        * @tparam Systems Types of systems
+        * @tparam Args Types of arguments used to construct
+        * @param args Arguments for context initialization
+        * @note The systems are registered (default constructed) after the context.
+        * The members OnPreInit, OnInit, ..., OnTick, OnUpdate, OnRender, ..., OnPostShutdown
+        * (named after the events, with or without the event argument) are called directly
+        * in the order of the list, before the listeners subscribed at runtime.
+        * Static systems must not be removed while the engine is running, RemoveSystem asserts it.
+        */
+        template <std::derived_from<Engine::Context> T = Context, typename... Systems, typename... Args>
+        requires Traits::ConstructibleAggregateFrom<T, Args...>
+        static void Initialize(StaticSystems<Systems...>, [[maybe_unused]] Args&&... args);
+
+        /**
+        * @brief Initialize the engine context for sharing between the executable and plugins
+        * @param ctx Context object for support shared memory and across boundary
+        * @note This overload is used to share the context object between the executable and plugins
+        */
+        static void Initialize(Context& ctx) noexcept;
+
+        /**
+        * @brief Create the engine (shard) bound to the current thread
+        *
+        * @code{.cpp}
+        * std::jthread zone([]() {
+        *     auto shard = Helena::Engine::CreateShard();
+        *     Helena::Engine::SetTickrate(60.);
+        *     Helena::Engine::SubscribeEvent<Helena::Events::Engine::Update, &OnUpdate>();
+        *     while(Helena::Engine::Heartbeat()) {}
+        * });
+        * @endcode
+        *
+        * @tparam T Context type
+        * @tparam Args Types of arguments used to construct
+        * @param args Arguments for context initialization
+        * @return Owner of the shard context
+        * @note All Engine functions called on the thread use the context of the shard:
+        * systems, components, signals, tickrate and Heartbeat are independent of other shards.
+        * Shards do not register the process signal handlers and do not start the worker threads
+        * of Jobs (jobs run inline until Jobs().Start is called). Use PostSignal to send
+        * the events between the shards.
+        */
+        template <std::derived_from<Engine::Context> T = Context, typename... Args>
+        requires Traits::ConstructibleAggregateFrom<T, Args...>
+        [[nodiscard]] static Shard CreateShard([[maybe_unused]] Args&&... args);
+
+        /**
+        * @brief Returns the mailbox of the context used by the current thread
+        * @return Mailbox of the engine or of the shard
+        */
+        [[nodiscard]] static Mailbox GetMailbox() noexcept;
+
+        /**
+        * @brief Has context of Engine
+        * @note This method can be used to check the initialization of the framework.
+        * @return Return a reference to context
+        */
+        [[nodiscard]] static bool HasContext() noexcept;
+
+        /**
+        * @brief Get context of Engine
+        * @return Return a reference to context
+        */
+        template <std::derived_from<Engine::Context> T>
+        [[nodiscard]] static T& GetContext() noexcept;
+
+        /**
+        * @brief Return the current state of the engine
+        * @return EState state flag
+        */
+        [[nodiscard]] static EState GetState() noexcept;
+
+        /**
+        * @brief Set the update tickrate for the engine "Update" event
+        * @param tickrate Update frequency
+        * @note By default, 30 frames per second.
+        * The overload governor scales the tickrate by its current step (see: SetGovernor)
+        */
+        static void SetTickrate(double tickrate) noexcept;
+
+        /**
+        * @brief Returns the current engine tickrate
+        * @return Tickrate in float
+        * @note The tickrate lowered by the overload governor (see: SetGovernor)
+        */
+        [[nodiscard]] static double GetTickrate() noexcept;
+
+        /**
+        * @brief Set the policy of the overload governor
+        *
+        * @code{.cpp}
+        * // Under sustained load: skip Render, then run Update at 75% and 50% of the tickrate
+        * Helena::Engine::SetGovernor({
+        *     .m_Steps = {{1., true}, {.75, true}, {.5, true}},
+        *     .m_OverloadFrames = 60,
+        *     .m_RecoverFrames = 300
+        * });
+        *
+        * Helena::Engine::SubscribeEvent<Helena::Events::Engine::GovernorTransition, &OnGovernor>();
+        * @endcode
+        *
+        * @param governor Policy, the governor is disabled when the steps are empty
+        * @warning The scale of each step must be in range (0, 1], the policy with another scale is a fatal error.
+        * @note By default, disabled. The governor moves one step at a time and every
+        * transition signals Events::Engine::GovernorTransition. Setting the policy restores the tickrate.
+        */
+        static void SetGovernor(Governor governor);
+
+        /**
+        * @brief Returns the policy of the overload governor
+        * @return Reference to the policy
+        */
+        [[nodiscard]] static const Governor& GetGovernor() noexcept;
+
+        /**
+        * @brief Returns the current step of the overload governor
+        * @return Zero if the tickrate is not lowered, otherwise the index of step + 1
+        */
+        [[nodiscard]] static std::uint32_t GetGovernorLevel() noexcept;
+
+        /**
+        * @brief Get time elapsed since Initialize
+        * @return Return a time elapsed since Initialize in milliseconds
+        * @note The time is measured by the monotonic clock with sub-millisecond resolution
+        */
+        [[nodiscard]] static double GetTimeElapsed() noexcept;
+
+        /**
+        * @brief Get the statistics of Heartbeat frames
+        *
+        * @code{.cpp}
+        * const auto& stats = Helena::Engine::GetFrameStats();
+        * const auto p99 = stats.GetFrameTime().Percentile(99.);
+        * const auto exhausted = stats.GetExhausted();
+        * @endcode
+        *
+        * @return Reference to the frame statistics (time in nanoseconds)
+        * @note Statistics are collected in fixed memory and are always enabled
+        */
+        [[nodiscard]] static const FrameStats& GetFrameStats() noexcept;
+
+        /**
+        * @brief Reset the statistics of Heartbeat frames
+        */
+        static void ResetFrameStats() noexcept;
+
+        /**
+        * @brief Set the dispatch mode of listeners for Tick, Update and Render phases
+        *
+        * @code{.cpp}
+        * Helena::Engine::SetDispatch(Helena::Engine::EDispatch::Parallel);
+        * Helena::Engine::SubscribeEvent<Helena::Events::Engine::Update, &Physics::OnUpdate>(this,
+        *     Helena::Engine::Reads<Input>{}, Helena::Engine::Writes<Physics>{});
+        * @endcode
+        *
+        * @param dispatch Dispatch mode
+        * @note By default, EDispatch::Serial.
+        * In parallel mode the listeners of each phase event (PreTick, Tick, ..., PostRender) are
+        * grouped into waves by their declared Reads/Writes sets, listeners of one wave are executed
+        * concurrently on the job system (see: Engine::Jobs), waves are executed in the serial dispatch order.
+        * A listener without declared access conflicts with all other listeners.
+        * Phase order (Pre/Main/Post) is not changed.
+        * @warning Listeners executed in parallel must not subscribe or unsubscribe events
+        */
+        static void SetDispatch(EDispatch dispatch) noexcept;
 
         /**
-        * @brief Initialize the engine context for sharing between the executable and plugins
-        * @param ctx Context object for support shared memory and across boundary
-        * @note This overload is used to share the context object between the executable and plugins
+        * @brief Returns the current dispatch mode of listeners
+        * @return EDispatch mode
         */
-        static void Initialize(Context& ctx) noexcept;
+        [[nodiscard]] static EDispatch GetDispatch() noexcept;
 
         /**
-        * @brief Has context of Engine
-        * @note This method can be used to check the initialization of the framework.
-        * @return Return a reference to context
+        * @brief Set the drain order of the deferred events
+        *
+        * @code{.cpp}
+        * Helena::Engine::SetDeferred(Helena::Engine::EDeferred::Strict);
+        * @endcode
+        *
+        * @param deferred Drain order
+        * @note By default, EDeferred::Batched (see: EDeferred)
         */
-        [[nodiscard]] static bool HasContext() noexcept;
+        static void SetDeferred(EDeferred deferred) noexcept;
 
         /**
-        * @brief Get context of Engine
-        * @return Return a reference to context
+        * @brief Returns the current drain order of the deferred events
+        * @return EDeferred order
         */
-        template <std::derived_from<Engine::Context> T>
-        [[nodiscard]] static T& GetContext() noexcept;
+        [[nodiscard]] static EDeferred GetDeferred() noexcept;
 
         /**
-        * @brief Return the current state of the engine
-        * @return EState state flag
+        * @brief Get the job system of the engine
+        *
+        * @code{.cpp}
+        * auto& jobs = Helena::Engine::Jobs();
+        * const auto root = jobs.Create([]{});
+        * for(auto& chunk : chunks) {
+        *     jobs.Run([&chunk]{ Process(chunk); }, root);
+        * }
+        *
+        * jobs.Schedule(root);
+        * jobs.WaitFor(root);
+        * @endcode
+        *
+        * @return Reference to the job system
+        * @note The job system is started in Initialize with (hardware concurrency - 1) worker threads,
+        * it is drained and joined when the engine is shutting down (before the systems are removed).
         */
-        [[nodiscard]] static EState GetState() noexcept;
+        [[nodiscard]] static Types::JobSystem& Jobs() noexcept;
 
+    #if defined(HELENA_ENGINE_PROFILER)
         /**
-        * @brief Set the update tickrate for the engine "Update" event
-        * @param tickrate Update frequency
-        * @note By default, 30 frames per second
+        * @brief Returns the listeners with the largest total dispatch time
+        *
+        * @code{.cpp}
+        * for(const auto profile : Helena::Engine::GetListenerProfiles(10)) {
+        *     const auto p99 = profile->GetHistogram().Percentile(99.);
+        * }
+        * @endcode
+        *
+        * @param count Maximum count of listeners, zero: all listeners
+        * @return Profiles sorted by total time in descending order
+        * @note Available only if HELENA_ENGINE_PROFILER is defined (CMake: HELENA_FLAG_PROFILER).
+        * Statistics are collected per pair (Event, Callback) for all instances of the listener.
         */
-        static void SetTickrate(double tickrate) noexcept;
+        [[nodiscard]] static std::vector<const ListenerProfile*> GetListenerProfiles(std::size_t count = 0);
 
         /**
-        * @brief Returns the current engine tickrate
-        * @return Tickrate in float
+        * @brief Print the statistics of the listeners in the log
+        * @param count Maximum count of listeners, zero: all listeners
+        * @note Called on shutdown of the engine
         */
-        [[nodiscard]] static double GetTickrate() noexcept;
+        static void DumpListenerProfiles(std::size_t count = 0);
 
         /**
-        * @brief Get time elapsed since Initialize
-        * @return Return a time elapsed since Initialize
+        * @brief Reset the statistics of the listeners
         */
-        [[nodiscard]] static std::uint64_t GetTimeElapsed() noexcept;
+        static void ResetListenerProfiles() noexcept;
+    #endif // HELENA_ENGINE_PROFILER
 
         /**
         * @brief Heartbeat of the engine
@@ -324,6 +1766,8 @@ namespace Helena
         * It is not recommended to use a large value for Accumulate, your thread may get stuck in a loop.
         * The correct solution is to offload the thread by finding a performance bottleneck.
         * Field: Sleep -> your own sleep function.
+        * Built-in configurations: DefaultConfig (sleep 1 ms), LowCPUConfig and LowJitterConfig
+        * (sleep until the deadline of the next Update step).
         */
         template <typename HeartbeatConfig = DefaultConfig>
         requires Engine::RequiresConfig<HeartbeatConfig>
@@ -447,6 +1891,93 @@ namespace Helena
         requires Traits::ConstructibleAggregateFrom<T, Args...>
         static void RegisterSystem(Args&&... args);
 
+        /**
+        * @brief Register the systems, independent systems are constructed in parallel
+        *
+        * @code{.cpp}
+        * struct Database {
+        *     Database() { Connect(); }   // I/O in constructor
+        * };
+        *
+        * struct Assets {
+        *     Assets() { Load(); }
+        * };
+        *
+        * struct World {
+        *     using Dependencies = Helena::Engine::DependsOn<Database, Assets>;
+        *     World() : m_Players{Helena::Engine::GetSystem<Database>().LoadPlayers()} {}
+        * };
+        *
+        * // Database and Assets are constructed concurrently, World after both
+        * Helena::Engine::RegisterSystems<World, Database, Assets>();
+        * @endcode
+        *
+        * @tparam Systems Types of systems
+        * @note The systems declare their dependencies with the nested alias Dependencies (see: DependsOn).
+        * The dependencies form a graph that is split into waves: systems of the wave are constructed by
+        * the jobs (see: Jobs) and registered in the order of the list, the next wave starts after.
+        * Dependencies outside of the list must be registered before the call, cycles are compile errors.
+        * The systems of the list must be unique and not registered yet.
+        * PreRegisterSystem of all systems is signaled before the construction, PostRegisterSystem of
+        * the system after it is registered. The construction time of each system is logged as Benchmark.
+        * Exceptions of the constructors are rethrown after the wave.
+        * The constructors run on the worker threads: they can use GetSystem, HasSystem,
+        * SubscribeEvent, UnsubscribeEvent and EnqueueSignalConcurrent. The subscriptions are
+        * serialized by a lock while the systems are constructed, the order of the listeners
+        * subscribed by the constructors of the same wave is not defined.
+        * Other calls of the engine (e.g. RegisterSystem, RemoveSystem, SignalEvent, EnqueueSignal)
+        * are not allowed in the constructors.
+        */
+        template <typename... Systems>
+        requires (sizeof...(Systems) > 0 && (std::is_default_constructible_v<Systems> && ...))
+        static void RegisterSystems();
+
+        /**
+        * @brief Resolve the type indexes of systems in bulk
+        *
+        * @code{.cpp}
+        * // Plugin entry point
+        * Helena::Engine::Initialize(ctx);
+        * Helena::Engine::PrefillSystems<MySystemA, MySystemB>();
+        * Helena::Engine::PrefillEvents<MyEventA, MyEventB>();
+        * @endcode
+        *
+        * @tparam T Types of systems
+        * @note Type indexes are cached per module (executable or plugin) on the first access,
+        * the prefill resolves them with a single lookup pass in the registry of the context.
+        */
+        template <typename... T>
+        static void PrefillSystems();
+
+        /**
+        * @brief Resolve the type indexes of components in bulk (see: PrefillSystems)
+        * @tparam T Types of components
+        */
+        template <typename... T>
+        static void PrefillComponents();
+
+        /**
+        * @brief Resolve the type indexes of events in bulk (see: PrefillSystems)
+        * @tparam T Types of events
+        */
+        template <typename... T>
+        static void PrefillEvents();
+
+        /**
+        * @brief Place systems and components of the context in a contiguous arena
+        *
+        * @code{.cpp}
+        * Helena::Engine::Initialize();
+        * Helena::Engine::EnableArenaStorage();
+        * Helena::Engine::RegisterSystems<MySystemA, MySystemB>();
+        * @endcode
+        *
+        * @note Instances registered before the call stay in the heap.
+        * Each instance is aligned to the cache line and keeps its address when the type
+        * is registered again after the removal. The arena is released with the context.
+        */
+        static void EnableArenaStorage();
+
         /**
         * @brief Check the exist of system
         * 
@@ -671,6 +2202,70 @@ namespace Helena
         template <typename... T>
         static void RemoveComponent();
 
+        /**
+        * @brief Get the entities of the context
+        *
+        * @code{.cpp}
+        * struct Position { float x, y; };
+        * struct Velocity { float x, y; };
+        *
+        * void OnAttach(const Helena::Events::Engine::AttachComponent<Velocity>& event) {}
+        *
+        * auto& entities = Helena::Engine::GetEntities();
+        * const auto entity = entities.Create();
+        * entities.Emplace<Position>(entity, 0.f, 0.f);
+        * entities.Emplace<Velocity>(entity, 1.f, 1.f);
+        *
+        * entities.View<Position, Velocity>().Each([](Position& position, const Velocity& velocity) {
+        *     position.x += velocity.x;
+        *     position.y += velocity.y;
+        * });
+        * @endcode
+        *
+        * @return Reference to the entity registry
+        * @note Components of entities are stored in sparse sets, one pool per type.
+        * AttachComponent<T> is signaled after the component is added, DetachComponent<T>
+        * before it is removed. Entities are cleared on shutdown without the notifications.
+        * The pools use the DefaultAllocator, another resource can be set by EntityRegistry::SetResource
+        * before the first component is added.
+        */
+        [[nodiscard]] static EntityRegistry& GetEntities();
+
+        /**
+        * @brief Call the callback for each entity of the view on the job system
+        *
+        * @code{.cpp}
+        * struct Position { float x, y; };
+        * struct Velocity { float x, y; };
+        *
+        * const auto view = Helena::Engine::GetEntities().View<Position, Velocity>();
+        * Helena::Engine::ParallelEach(view, [](Position& position, const Velocity& velocity) {
+        *     position.x += velocity.x;
+        *     position.y += velocity.y;
+        * });
+        *
+        * // Temporary memory of the chunk, released when the chunk is finished
+        * Helena::Engine::ParallelEach(view, [](Helena::Types::IMemoryResource* scratch, Helena::Types::Entity entity, Position& position, Velocity&) {
+        *     std::vector<Helena::Types::Entity, Helena::Types::MemoryAllocator<Helena::Types::Entity>> nearby{scratch};
+        * }, 256);
+        * @endcode
+        *
+        * @tparam T Types of components of the view
+        * @param view View of the entities (see: EntityRegistry::View)
+        * @param callback Function with signature: void(Entity, T&...), void(T&...),
+        * void(IMemoryResource*, Entity, T&...) or void(IMemoryResource*, T&...)
+        * @param grainSize Count of candidates of the view in one chunk
+        * @note Entities() of the view are split into chunks of grainSize candidates, the bounds of
+        * chunks depend only on the size of the view and the grain. The grain grows when the view would be split
+        * into more than 1024 chunks, a smaller grain on a large view costs more in scheduling than it gains. Chunks are executed concurrently by the jobs (see: Jobs) and the call
+        * returns when all chunks are finished, the first exception in the order of chunks is rethrown.
+        * The callback can change the components of the current entity only: creating and destroying
+        * entities or adding and removing components is not thread safe.
+        * The scratch memory is allocated on the stack of the chunk and falls back to the heap.
+        */
+        template <typename... T, typename Callback>
+        static void ParallelEach(const Types::EntityView<T...>& view, Callback&& callback, std::size_t grainSize = 1024);
+
         /**
         * @brief Listening to the event
         *
@@ -684,10 +2279,11 @@ namespace Helena
         *
         * @tparam Event Type of event
         * @tparam Callback Function
+        * @return Handle of the listener for UnsubscribeEvent
         */
         template <typename Event, auto Callback>
         requires Engine::RequiresCallback<Event, Callback, /* Member function */ false>
-        static void SubscribeEvent();
+        static Subscription SubscribeEvent();
 
         /**
         * @brief Listening to the event
@@ -704,10 +2300,107 @@ namespace Helena
         * @tparam Event Type of event
         * @tparam Callback Member function
         * @param instance Instance of object
+        * @return Handle of the listener for UnsubscribeEvent
+        */
+        template <typename Event, auto Callback>
+        requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
+        static Subscription SubscribeEvent(typename Traits::Function<decltype(Callback)>::Class* instance);
+
+        /**
+        * @brief Listening to the event with declared access
+        *
+        * @code{.cpp}
+        * void OnUpdate(const Helena::Events::Engine::Update& event) {
+        *   // Read Input, write Physics
+        * }
+        *
+        * Helena::Engine::SubscribeEvent<Helena::Events::Engine::Update, &OnUpdate>(
+        *     Helena::Engine::Reads<Input>{}, Helena::Engine::Writes<Physics>{});
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @tparam Callback Function
+        * @tparam R Types that the listener reads
+        * @tparam W Types that the listener writes
+        * @return Handle of the listener for UnsubscribeEvent
+        * @note Access is used only in EDispatch::Parallel mode (see: SetDispatch)
+        */
+        template <typename Event, auto Callback, typename... R, typename... W>
+        requires Engine::RequiresCallback<Event, Callback, /* Member function */ false>
+        static Subscription SubscribeEvent(Reads<R...>, Writes<W...>);
+
+        /**
+        * @brief Listening to the event with declared access
+        *
+        * @code{.cpp}
+        * struct Physics {
+        *   void OnUpdate(const Helena::Events::Engine::Update& event) {
+        *       // Read Input, write Physics
+        *   }
+        * };
+        * Helena::Engine::SubscribeEvent<Helena::Events::Engine::Update, &Physics::OnUpdate>(this,
+        *     Helena::Engine::Reads<Input>{}, Helena::Engine::Writes<Physics>{});
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @tparam Callback Member function
+        * @tparam R Types that the listener reads
+        * @tparam W Types that the listener writes
+        * @param instance Instance of object
+        * @return Handle of the listener for UnsubscribeEvent
+        * @note Access is used only in EDispatch::Parallel mode (see: SetDispatch)
+        */
+        template <typename Event, auto Callback, typename... R, typename... W>
+        requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
+        static Subscription SubscribeEvent(typename Traits::Function<decltype(Callback)>::Class* instance, Reads<R...>, Writes<W...>);
+
+        /**
+        * @brief Listening to the event with the key
+        *
+        * @code{.cpp}
+        * void OnDamage(const Damage& event) {
+        *   // Called only for the signals of player 42
+        * }
+        *
+        * Helena::Engine::SubscribeEvent<Damage, &OnDamage>(Helena::Engine::Key{42});
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @tparam Callback Function
+        * @param key Key of listener
+        * @return Handle of the listener for UnsubscribeEvent
+        * @note Keyed listeners receive only the signals with their key (see: SignalEvent),
+        * a signal with the key costs O(listeners of the key).
+        */
+        template <typename Event, auto Callback>
+        requires Engine::RequiresCallback<Event, Callback, /* Member function */ false>
+        static Subscription SubscribeEvent(Key key);
+
+        /**
+        * @brief Listening to the event with the key
+        *
+        * @code{.cpp}
+        * struct Unit {
+        *   void OnDamage(Damage& event) {
+        *       // Called only for the signals of this unit
+        *   }
+        *   std::uint64_t m_Id;
+        * };
+        *
+        * Helena::Engine::SubscribeEvent<Damage, &Unit::OnDamage>(Helena::Engine::Key{unit.m_Id}, &unit);
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @tparam Callback Member function
+        * @param key Key of listener
+        * @param instance Instance of object
+        * @return Handle of the listener for UnsubscribeEvent
+        * @note Keyed listeners receive only the signals with their key (see: SignalEvent),
+        * a signal with the key costs O(listeners of the key).
         */
         template <typename Event, auto Callback>
         requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
-        static void SubscribeEvent(typename Traits::Function<decltype(Callback)>::Class* instance);
+        static Subscription SubscribeEvent(Key key, typename Traits::Function<decltype(Callback)>::Class* instance);
 
         /**
         * @brief Returns the count or tuple with counts of listeners subscribed to Event
@@ -772,17 +2465,115 @@ namespace Helena
         requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
         static void SignalEvent(Event& event);
 
+        /**
+        * @brief Trigger an event for the listeners of the key
+        *
+        * @code{.cpp}
+        * Helena::Engine::SignalEvent<Damage>(Helena::Engine::Key{unit.m_Id}, 10.f);
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @tparam Args Types of arguments
+        * @param key Key of listeners
+        * @param args Arguments for construct the event
+        * @note Listeners without the key are not called, the listeners of the key
+        * are called in the serial dispatch order.
+        */
+        template <typename Event, typename... Args>
+        requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+        static void SignalEvent(Key key, [[maybe_unused]] Args&&... args);
+
+        /**
+        * @brief Trigger events of the batch for all listeners
+        *
+        * @code{.cpp}
+        * struct DamageApplied {
+        *     Entity m_Entity;
+        *     float m_Damage;
+        * };
+        *
+        * // Listener of the whole batch
+        * void OnDamage(std::span<DamageApplied> events) {
+        *     for(auto& event : events) {}
+        * }
+        *
+        * Helena::Engine::SubscribeEvent<DamageApplied, &OnDamage>();
+        * Helena::Engine::SignalEvents<DamageApplied>(damages);
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @param events Events of signal (by reference)
+        * @note The pool of listeners is found once, listeners are called in the order of SignalEvent,
+        * each listener receives all events of the batch before the next listener (listener-major).
+        * Listeners that take std::span<Event> are called once with the whole batch,
+        * SignalEvent calls them with a span of one event.
+        * The engine events are signaled one by one to keep their dispatch modes.
+        */
+        template <typename Event>
+        requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+        static void SignalEvents(std::span<Event> events);
+
         /**
         * @brief Push signal event in queue for call in next Engine tick
         *
         * @tparam Event Type of event
         * @tparam Args Types of arguments
         * @param args Arguments for construct the event or lvalue of event
+        * @note Events are stored contiguously per type without type erasure, the storage is reused
+        * between frames. The events enqueued by listeners while draining are delivered in the next tick.
+        * The drain order depends on the mode (see: SetDeferred, EDeferred).
         */
         template <typename Event, typename... Args>
         requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
         static void EnqueueSignal(Args&&... args);
 
+        /**
+        * @brief Push signal event in queue for call in next Engine tick from any thread
+        *
+        * @code{.cpp}
+        * struct PacketReceived {
+        *     std::vector<std::byte> m_Data;
+        * };
+        *
+        * // Network thread
+        * Helena::Engine::EnqueueSignalConcurrent<PacketReceived>(std::move(data));
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @tparam Args Types of arguments
+        * @param args Arguments for construct the event or lvalue of event
+        * @note Lock-free: each producer thread appends to its own queue, Heartbeat moves
+        * the events to the deferred queues (see: EnqueueSignal) before the deferred drain.
+        * Events of one thread keep their order, there is no order between the threads.
+        * Events larger than 48 bytes are allocated on the heap.
+        */
+        template <typename Event, typename... Args>
+        requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+        static void EnqueueSignalConcurrent(Args&&... args);
+
+        /**
+        * @brief Push signal event in queue of the other engine (shard) for call in its next tick
+        *
+        * @code{.cpp}
+        * struct PlayerTransfer {
+        *     std::uint64_t m_Player;
+        * };
+        *
+        * Helena::Engine::PostSignal<PlayerTransfer>(zones[next].GetMailbox(), player);
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @tparam Args Types of arguments
+        * @param mailbox Mailbox of the target engine
+        * @param args Arguments for construct the event or lvalue of event
+        * @return True if the event is posted, or false if the target is destroyed
+        * @note Lock-free, the events are delivered at the deferred signals of the target
+        * (see: EnqueueSignalConcurrent). The destructor of the target waits for the posting threads.
+        */
+        template <typename Event, typename... Args>
+        requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+        static bool PostSignal(const Mailbox& mailbox, Args&&... args);
+
         /**
         * @brief Stop listening to the event
         *
@@ -822,14 +2613,94 @@ namespace Helena
         requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
         static void UnsubscribeEvent(typename Traits::Function<decltype(Callback)>::Class* instance);
 
+        /**
+        * @brief Stop listening to the event with the key
+        *
+        * @code{.cpp}
+        * Helena::Engine::UnsubscribeEvent<Damage, &OnDamage>(Helena::Engine::Key{42});
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @tparam Callback Function
+        * @param key Key of listener
+        */
+        template <typename Event, auto Callback>
+        requires Engine::RequiresCallback<Event, Callback, /* Member function */ false>
+        static void UnsubscribeEvent(Key key);
+
+        /**
+        * @brief Stop listening to the event with the key
+        *
+        * @code{.cpp}
+        * Helena::Engine::UnsubscribeEvent<Damage, &Unit::OnDamage>(Helena::Engine::Key{unit.m_Id}, &unit);
+        * @endcode
+        *
+        * @tparam Event Type of event
+        * @tparam Callback Member function
+        * @param key Key of listener
+        * @param instance Instance of object
+        */
+        template <typename Event, auto Callback>
+        requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
+        static void UnsubscribeEvent(Key key, typename Traits::Function<decltype(Callback)>::Class* instance);
+
+        /**
+        * @brief Stop listening to the event by handle
+        *
+        * @code{.cpp}
+        * struct Unit {
+        *   void OnUpdate(const Helena::Events::Engine::Update& event) {}
+        *   Helena::Engine::Subscription m_Subscription;
+        * };
+        *
+        * unit.m_Subscription = Helena::Engine::SubscribeEvent<Helena::Events::Engine::Update, &Unit::OnUpdate>(&unit);
+        * Helena::Engine::UnsubscribeEvent(unit.m_Subscription);
+        * @endcode
+        *
+        * @param subscription Handle of the listener, reset after the call
+        * @note O(1), the handle of an already removed listener is ignored.
+        * It is safe to subscribe and unsubscribe from inside the listeners of serial dispatch,
+        * the listeners of EDispatch::Parallel must not change the subscriptions.
+        */
+        static void UnsubscribeEvent(Subscription& subscription);
+
     private:
         template <typename Event>
         requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
-        static void SignalEvent(EventsPool<Delegate>& pool, Event& event);
+        static void SignalEvent(Listeners& pool, Event& event);
+
+        template <typename Event>
+        requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+        static void ParallelSignalEvent(Listeners& pool, Event& event);
+
+        template <typename Event>
+        static void SerialSignalEvent(Listeners& pool, Event& event);
+
+        template <typename Event>
+        requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+        static void SignalEvents(Listeners& pool, std::span<Event> events);
 
         template <typename Event, auto Callback>
         requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
-        static void SubscribeEvent(Delegate::Args<Event, Callback>, void* instance);
+        static Subscription SubscribeEvent(Delegate::Args<Event, Callback>, void* instance, const AccessInfo* access = nullptr);
+
+        template <typename Event, auto Callback>
+        static Subscription SubscribeEvent(Key key, Delegate::Args<Event, Callback>, void* instance);
+
+        template <typename Event, auto Callback>
+        [[nodiscard]] static std::uint32_t SubscribeEvent(Listeners& pool, std::uint64_t serial, void* instance, const AccessInfo* access);
+
+        //! Lock of the listeners, it's locked only while RegisterSystems constructs the systems
+        [[nodiscard]] static std::unique_lock<Types::Spinlock> LockSignals(Context& ctx);
+
+        template <typename Event>
+        static void UnsubscribeEvent(const Subscription& subscription);
+
+        template <typename Event>
+        static void UnsubscribeKeyedEvent(const Subscription& subscription);
+
+        template <typename Event, auto Callback>
+        static void UnsubscribeEvent(Key key, Delegate::Args<Event, Callback>, void* instance);
 
         template <typename Event, auto Callback>
         requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
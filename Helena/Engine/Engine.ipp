@@ -7,13 +7,78 @@
 #include <Helena/Types/DateTime.hpp>
 #include <Helena/Util/String.hpp>
 
+namespace Helena::Internal
+{
+    // Members of systems called by the static dispatch of the engine events
+    template <typename Event>
+    struct StaticListener;
+
+#define HELENA_ENGINE_STATIC_LISTENER(index, name, method)                                              \
+    template <>                                                                                         \
+    struct StaticListener<Events::Engine::name>                                                         \
+    {                                                                                                   \
+        static constexpr std::size_t Index = index;                                                     \
+                                                                                                        \
+        template <typename T>                                                                           \
+        static constexpr bool Has = requires(T& system, Events::Engine::name& event) {                  \
+            system.method(event);                                                                       \
+        } || requires(T& system) {                                                                      \
+            system.method();                                                                            \
+        };                                                                                              \
+                                                                                                        \
+        template <typename T>                                                                           \
+        static HELENA_FORCEINLINE void Invoke(T& system, [[maybe_unused]] Events::Engine::name& event) {\
+            if constexpr(requires { system.method(event); }) {                                          \
+                system.method(event);                                                                   \
+            } else {                                                                                    \
+                system.method();                                                                        \
+            }                                                                                           \
+        }                                                                                               \
+    };
+
+    HELENA_ENGINE_STATIC_LISTENER(0,  PreInit,      OnPreInit)
+    HELENA_ENGINE_STATIC_LISTENER(1,  Init,         OnInit)
+    HELENA_ENGINE_STATIC_LISTENER(2,  PostInit,     OnPostInit)
+    HELENA_ENGINE_STATIC_LISTENER(3,  PreConfig,    OnPreConfig)
+    HELENA_ENGINE_STATIC_LISTENER(4,  Config,       OnConfig)
+    HELENA_ENGINE_STATIC_LISTENER(5,  PostConfig,   OnPostConfig)
+    HELENA_ENGINE_STATIC_LISTENER(6,  PreExecute,   OnPreExecute)
+    HELENA_ENGINE_STATIC_LISTENER(7,  Execute,      OnExecute)
+    HELENA_ENGINE_STATIC_LISTENER(8,  PostExecute,  OnPostExecute)
+    HELENA_ENGINE_STATIC_LISTENER(9,  PreTick,      OnPreTick)
+    HELENA_ENGINE_STATIC_LISTENER(10, Tick,         OnTick)
+    HELENA_ENGINE_STATIC_LISTENER(11, PostTick,     OnPostTick)
+    HELENA_ENGINE_STATIC_LISTENER(12, PreUpdate,    OnPreUpdate)
+    HELENA_ENGINE_STATIC_LISTENER(13, Update,       OnUpdate)
+    HELENA_ENGINE_STATIC_LISTENER(14, PostUpdate,   OnPostUpdate)
+    HELENA_ENGINE_STATIC_LISTENER(15, PreRender,    OnPreRender)
+    HELENA_ENGINE_STATIC_LISTENER(16, Render,       OnRender)
+    HELENA_ENGINE_STATIC_LISTENER(17, PostRender,   OnPostRender)
+    HELENA_ENGINE_STATIC_LISTENER(18, PreFinalize,  OnPreFinalize)
+    HELENA_ENGINE_STATIC_LISTENER(19, Finalize,     OnFinalize)
+    HELENA_ENGINE_STATIC_LISTENER(20, PostFinalize, OnPostFinalize)
+    HELENA_ENGINE_STATIC_LISTENER(21, PreShutdown,  OnPreShutdown)
+    HELENA_ENGINE_STATIC_LISTENER(22, Shutdown,     OnShutdown)
+    HELENA_ENGINE_STATIC_LISTENER(23, PostShutdown, OnPostShutdown)
+
+#undef HELENA_ENGINE_STATIC_LISTENER
+
+    template <typename Event, typename... Systems>
+    inline constexpr bool StaticListenerAny = (StaticListener<Event>::template Has<Systems> || ...);
+}
+
 namespace Helena
 {
     inline void Engine::InitContext(ContextStorage context) noexcept {
         m_Context = std::move(context);
     }
 
-    [[nodiscard]] inline Engine::Context& Engine::MainContext() noexcept {
+    [[nodiscard]] inline Engine::Context& Engine::MainContext() noexcept
+    {
+        if(const auto shard = m_ShardContext) [[unlikely]] {
+            return *shard;
+        }
+
         HELENA_ASSERT(m_Context, "Context not initialized!");
         return *m_Context;
     }
@@ -244,21 +309,106 @@ namespace Helena
     }
 #endif
 
-    [[nodiscard]] inline std::uint64_t Engine::GetTickTime() noexcept
+    [[nodiscard]] inline std::uint64_t Engine::GetTickTime() noexcept {
+        return Util::Process::MonotonicTime();
+    }
+
+    template <bool Spin>
+    void Engine::SleepUntilDeadline()
     {
-#if defined(HELENA_PLATFORM_WIN)
-        static LARGE_INTEGER frequency{};
-        static const auto queryFrequency = ::QueryPerformanceFrequency(&frequency);
-        LARGE_INTEGER now;
-        std::uint64_t ms = queryFrequency && ::QueryPerformanceCounter(&now)
-            ? ((1000LL * now.QuadPart) / frequency.QuadPart)
-            : ::GetTickCount64();
-#else
-        struct timeval te;
-        ::gettimeofday(&te, nullptr);
-        std::uint64_t ms = te.tv_sec * 1000LL + te.tv_usec / 1000;
-#endif
-        return ms;
+        // The next Update step is due when the accumulator reaches the tickrate
+        auto& ctx = MainContext();
+        const auto now = GetTickTime();
+        const auto deadline = ctx.m_TimeNow + ctx.m_TickRate - (std::min)(ctx.m_TimeAccumulator, ctx.m_TickRate);
+        if(deadline <= now) {
+            return;
+        }
+
+        HELENA_TRACE_SCOPE("Sleep", "Engine");
+        if constexpr(Spin)
+        {
+            // Wake up earlier by the observed oversleep of the OS and spin the rest
+            static constexpr std::uint64_t margin = 20'000;
+            auto& overshoot = ctx.m_SleepOvershoot;
+            const auto early = (std::min)(overshoot + margin, deadline - now);
+
+            if(const auto wake = deadline - early; wake > now) {
+                Util::Process::SleepUntil(wake);
+                const auto woke = GetTickTime();
+                const auto sample = woke > wake ? woke - wake : 0;
+                overshoot = (std::max)(sample, overshoot - overshoot / 16);
+            }
+
+            while(GetTickTime() < deadline) {
+                HELENA_PROCESSOR_YIELD();
+            }
+        } else {
+            Util::Process::SleepUntil(deadline);
+        }
+    }
+
+    [[nodiscard]] inline bool Engine::Conflicts(const AccessInfo* lhs, const AccessInfo* rhs) noexcept
+    {
+        // Listener without declared access can touch anything
+        if(!lhs || !rhs) {
+            return true;
+        }
+
+        const auto intersects = [](const std::uint64_t* first, std::size_t firstSize, const std::uint64_t* second, std::size_t secondSize) {
+            return std::any_of(first, first + firstSize, [second, secondSize](const auto key) {
+                return std::find(second, second + secondSize, key) != second + secondSize;
+            });
+        };
+
+        return intersects(lhs->m_Writes, lhs->m_WritesSize, rhs->m_Writes, rhs->m_WritesSize)
+            || intersects(lhs->m_Writes, lhs->m_WritesSize, rhs->m_Reads, rhs->m_ReadsSize)
+            || intersects(rhs->m_Writes, rhs->m_WritesSize, lhs->m_Reads, lhs->m_ReadsSize);
+    }
+
+    inline void Engine::BuildDispatchPlan(const Listeners& pool, DispatchPlan& plan)
+    {
+        // The serial dispatch order is reversed, the waves keep it for conflicting listeners
+        std::vector<std::uint32_t> alive;
+        alive.reserve(pool.Size());
+        for(std::size_t pos = pool.Slots(); pos; --pos) {
+            if(pool[pos - 1]) {
+                alive.push_back(static_cast<std::uint32_t>(pos - 1));
+            }
+        }
+
+        const auto size = alive.size();
+        const auto delegate = [&pool, &alive](std::size_t pos) -> const Delegate& {
+            return pool[alive[pos]];
+        };
+
+        std::vector<std::uint32_t> waves(size);
+        std::uint32_t count{};
+
+        for(std::size_t pos = 0; pos < size; ++pos)
+        {
+            std::uint32_t wave{};
+            for(std::size_t prev = 0; prev < pos; ++prev) {
+                if(waves[prev] >= wave && Conflicts(delegate(pos).Access(), delegate(prev).Access())) {
+                    wave = waves[prev] + 1;
+                }
+            }
+
+            waves[pos] = wave;
+            count = (std::max)(count, wave + 1);
+        }
+
+        plan.m_Order.clear();
+        plan.m_Waves.clear();
+
+        for(std::uint32_t wave = 0; wave < count; ++wave)
+        {
+            plan.m_Waves.push_back(static_cast<std::uint32_t>(plan.m_Order.size()));
+            for(std::size_t pos = 0; pos < size; ++pos) {
+                if(waves[pos] == wave) {
+                    plan.m_Order.push_back(alive[pos]);
+                }
+            }
+        }
     }
 
     template <std::derived_from<Engine::Context> T, typename... Args>
@@ -271,17 +421,109 @@ namespace Helena
         }});
         HELENA_ASSERT_RUNTIME(HasContext(), "Initialize Context failed!");
         RegisterHandlers();
+        HELENA_TRACE_THREAD("Engine");
+        StartJobs();
         MainContext().Main();
     }
 
+    template <std::derived_from<Engine::Context> T, typename... Systems, typename... Args>
+    requires Traits::ConstructibleAggregateFrom<T, Args...>
+    void Engine::Initialize(StaticSystems<Systems...>, [[maybe_unused]] Args&&... args)
+    {
+        Initialize<T>(std::forward<Args>(args)...);
+        (RegisterSystem<Systems>(), ...);
+
+        MainContext().m_StaticSystems = {std::addressof(GetSystem<Systems>())...};
+        InstallStaticDispatch<Systems...>(Signals<
+            Events::Engine::PreInit,        Events::Engine::Init,       Events::Engine::PostInit,
+            Events::Engine::PreConfig,      Events::Engine::Config,     Events::Engine::PostConfig,
+            Events::Engine::PreExecute,     Events::Engine::Execute,    Events::Engine::PostExecute,
+            Events::Engine::PreTick,        Events::Engine::Tick,       Events::Engine::PostTick,
+            Events::Engine::PreUpdate,      Events::Engine::Update,     Events::Engine::PostUpdate,
+            Events::Engine::PreRender,      Events::Engine::Render,     Events::Engine::PostRender,
+            Events::Engine::PreFinalize,    Events::Engine::Finalize,   Events::Engine::PostFinalize,
+            Events::Engine::PreShutdown,    Events::Engine::Shutdown,   Events::Engine::PostShutdown>{});
+    }
+
+    template <typename Event, typename... Systems>
+    void Engine::StaticDispatch(void* const* systems, void* event)
+    {
+        [systems, &event = *static_cast<Event*>(event)]<std::size_t... Index>(std::index_sequence<Index...>) {
+            ([&]() {
+                if constexpr(Internal::StaticListener<Event>::template Has<Systems>) {
+                    HELENA_TRACE_SCOPE(Traits::NameOf<Systems>, "Listener");
+                    Internal::StaticListener<Event>::Invoke(*static_cast<Systems*>(systems[Index]), event);
+                }
+            }(), ...);
+        }(std::index_sequence_for<Systems...>{});
+    }
+
+    template <typename... Systems, typename... Events>
+    void Engine::InstallStaticDispatch(Signals<Events...>)
+    {
+        static_assert(sizeof...(Events) == m_StaticEvents, "Static events count mismatch");
+
+        auto& table = MainContext().m_StaticDispatch;
+        ([&table]() {
+            if constexpr(Internal::StaticListenerAny<Events, Systems...>) {
+                table[Internal::StaticListener<Events>::Index] = &StaticDispatch<Events, Systems...>;
+            } else {
+                table[Internal::StaticListener<Events>::Index] = nullptr;
+            }
+        }(), ...);
+    }
+
+    template <typename Event, typename... Args>
+    void Engine::StaticSignalEvent([[maybe_unused]] Args&&... args)
+    {
+        auto& ctx = MainContext();
+        auto& dispatch = ctx.m_StaticDispatch[Internal::StaticListener<Event>::Index];
+        if(!dispatch) {
+            return;
+        }
+
+        Event event{std::forward<Args>(args)...};
+        dispatch(ctx.m_StaticSystems.data(), std::addressof(event));
+
+        // One-shot lifecycle events are dispatched once per run
+        if constexpr(Traits::AnyOf<Event,
+            Events::Engine::PreInit,        Events::Engine::Init,       Events::Engine::PostInit,
+            Events::Engine::PreConfig,      Events::Engine::Config,     Events::Engine::PostConfig,
+            Events::Engine::PreExecute,     Events::Engine::Execute,    Events::Engine::PostExecute,
+            Events::Engine::PreFinalize,    Events::Engine::Finalize,   Events::Engine::PostFinalize,
+            Events::Engine::PreShutdown,    Events::Engine::Shutdown,   Events::Engine::PostShutdown>) {
+            dispatch = nullptr;
+        }
+    }
+
     inline void Engine::Initialize(Context& ctx) noexcept {
         if(m_Context) {
             InitContext({std::addressof(ctx), +[](const Context*){}});
         }
     }
 
+    template <std::derived_from<Engine::Context> T, typename... Args>
+    requires Traits::ConstructibleAggregateFrom<T, Args...>
+    [[nodiscard]] Engine::Shard Engine::CreateShard([[maybe_unused]] Args&&... args)
+    {
+        HELENA_ASSERT_RUNTIME(!m_ShardContext, "Shard already created on this thread!");
+        Shard shard{{new (std::nothrow) T(std::forward<Args>(args)...), +[](const Context* ctx) {
+            delete static_cast<const T*>(ctx);
+        }}};
+        HELENA_ASSERT_RUNTIME(shard, "Create Shard failed!");
+
+        m_ShardContext = shard.m_Context.get();
+        HELENA_TRACE_THREAD("Shard");
+        MainContext().Main();
+        return shard;
+    }
+
+    [[nodiscard]] inline Engine::Mailbox Engine::GetMailbox() noexcept {
+        return Mailbox{MainContext().m_Mailbox};
+    }
+
     [[nodiscard]] inline bool Engine::HasContext() noexcept {
-        return static_cast<bool>(m_Context);
+        return m_ShardContext || m_Context;
     }
 
     template <std::derived_from<Engine::Context> T>
@@ -293,17 +535,206 @@ namespace Helena
         return MainContext().m_State.load(std::memory_order_acquire);
     }
 
-    inline void Engine::SetTickrate(double tickrate) noexcept {
-        MainContext().m_TickRate = 1. / (std::max)(tickrate, 1.);
+    inline void Engine::SetTickrate(double tickrate) noexcept
+    {
+        auto& ctx = MainContext();
+        ctx.m_BaseTickRate = static_cast<std::uint64_t>(1e9 / (std::max)(tickrate, 1.) + 0.5);
+        ctx.m_TickRate = ctx.m_GovernorLevel
+            ? static_cast<std::uint64_t>(static_cast<double>(ctx.m_BaseTickRate) / ctx.m_Governor.m_Steps[ctx.m_GovernorLevel - 1].m_Scale + 0.5)
+            : ctx.m_BaseTickRate;
     }
 
     [[nodiscard]] inline double Engine::GetTickrate() noexcept {
-        return 1. / MainContext().m_TickRate;
+        return 1e9 / static_cast<double>(MainContext().m_TickRate);
+    }
+
+    [[nodiscard]] inline double Engine::GetTimeElapsed() noexcept {
+        return static_cast<double>(GetTickTime() - MainContext().m_TimeStart) / 1e6;
+    }
+
+    inline void Engine::SetGovernor(Governor governor)
+    {
+        // The tickrate is divided by the scale of the step, checked in release too
+        const auto validScale = std::all_of(governor.m_Steps.cbegin(), governor.m_Steps.cend(), [](const auto& step) {
+            return step.m_Scale > 0. && step.m_Scale <= 1.;
+        });
+        HELENA_ASSERT_RUNTIME(validScale, "Scale of governor step out of range (0, 1]");
+
+        auto& ctx = MainContext();
+        ctx.m_Governor = std::move(governor);
+        ctx.m_GovernorLevel = 0;
+        ctx.m_GovernorOverloaded = 0;
+        ctx.m_GovernorHealthy = 0;
+        ctx.m_GovernorSkipRender = false;
+        ctx.m_TickRate = ctx.m_BaseTickRate;
+    }
+
+    [[nodiscard]] inline const Engine::Governor& Engine::GetGovernor() noexcept {
+        return MainContext().m_Governor;
+    }
+
+    [[nodiscard]] inline std::uint32_t Engine::GetGovernorLevel() noexcept {
+        return MainContext().m_GovernorLevel;
+    }
+
+    inline void Engine::SetGovernorLevel(std::uint32_t level)
+    {
+        auto& ctx = MainContext();
+        const auto previous = std::exchange(ctx.m_GovernorLevel, level);
+        const auto step = level ? ctx.m_Governor.m_Steps[level - 1] : GovernorStep{};
+
+        ctx.m_GovernorOverloaded = 0;
+        ctx.m_GovernorHealthy = 0;
+        ctx.m_GovernorSkipRender = step.m_SkipRender;
+        ctx.m_TickRate = static_cast<std::uint64_t>(static_cast<double>(ctx.m_BaseTickRate) / step.m_Scale + 0.5);
+
+        if(level > previous) {
+            HELENA_MSG_WARNING("Overload governor: level {} -> {}, tickrate: {:.2f}, render: {}",
+                previous, level, GetTickrate(), step.m_SkipRender ? "skip" : "on");
+        } else {
+            HELENA_MSG_NOTICE("Overload governor: level {} -> {}, tickrate: {:.2f}, render: {}",
+                previous, level, GetTickrate(), step.m_SkipRender ? "skip" : "on");
+        }
+
+        SignalEvent<Events::Engine::GovernorTransition>(previous, level, GetTickrate(), step.m_SkipRender);
+    }
+
+    inline void Engine::UpdateGovernor(std::uint64_t work, bool exhausted)
+    {
+        auto& ctx = MainContext();
+        const auto& governor = ctx.m_Governor;
+        const auto level = ctx.m_GovernorLevel;
+        const auto load = static_cast<double>(work) / static_cast<double>(ctx.m_TickRate);
+
+        if(exhausted || load >= governor.m_Overload)
+        {
+            ctx.m_GovernorHealthy = 0;
+            if(++ctx.m_GovernorOverloaded >= governor.m_OverloadFrames && level < governor.m_Steps.size()) {
+                SetGovernorLevel(level + 1);
+            }
+
+            return;
+        }
+
+        ctx.m_GovernorOverloaded = 0;
+        if(!level) {
+            return;
+        }
+
+        // Work of Update grows with the tickrate, predict the load of the previous step
+        const auto scale = governor.m_Steps[level - 1].m_Scale;
+        const auto previous = level > 1 ? governor.m_Steps[level - 2].m_Scale : 1.;
+        if(load * previous / scale < governor.m_Recover) {
+            if(++ctx.m_GovernorHealthy >= governor.m_RecoverFrames) {
+                SetGovernorLevel(level - 1);
+            }
+        } else {
+            ctx.m_GovernorHealthy = 0;
+        }
+    }
+
+    [[nodiscard]] inline const Engine::FrameStats& Engine::GetFrameStats() noexcept {
+        return MainContext().m_FrameStats;
+    }
+
+    inline void Engine::ResetFrameStats() noexcept {
+        MainContext().m_FrameStats = FrameStats{};
+    }
+
+    inline void Engine::SetDispatch(EDispatch dispatch) noexcept {
+        MainContext().m_Dispatch = dispatch;
+    }
+
+    [[nodiscard]] inline Engine::EDispatch Engine::GetDispatch() noexcept {
+        return MainContext().m_Dispatch;
+    }
+
+    inline void Engine::SetDeferred(EDeferred deferred) noexcept {
+        MainContext().m_Deferred = deferred;
+    }
+
+    [[nodiscard]] inline Engine::EDeferred Engine::GetDeferred() noexcept {
+        return MainContext().m_Deferred;
+    }
+
+    [[nodiscard]] inline Types::JobSystem& Engine::Jobs() noexcept {
+        return *MainContext().m_Jobs;
+    }
+
+    inline void Engine::StartJobs()
+    {
+        // Shards share the cores, the worker threads are started by the user
+        if(m_ShardContext) {
+            return;
+        }
+
+        if(auto& jobs = *MainContext().m_Jobs; !jobs.Running()) {
+            jobs.Start((std::max)(std::thread::hardware_concurrency(), 2u) - 1u);
+        }
+    }
+
+#if defined(HELENA_ENGINE_PROFILER)
+    [[nodiscard]] inline Engine::ListenerProfile* Engine::GetListenerProfile(const char* event, const char* listener)
+    {
+        // Names are compared by value, the storage is different across the boundary of plugins
+        auto& profiles = MainContext().m_Profiles;
+        const auto it = std::find_if(profiles.cbegin(), profiles.cend(), [event, listener](const auto& profile) {
+            return profile->GetEvent() == event && profile->GetListener() == listener;
+        });
+
+        if(it != profiles.cend()) {
+            return it->get();
+        }
+
+        return profiles.emplace_back(std::make_unique<ListenerProfile>(event, listener)).get();
+    }
+
+    [[nodiscard]] inline std::vector<const Engine::ListenerProfile*> Engine::GetListenerProfiles(std::size_t count)
+    {
+        const auto& profiles = MainContext().m_Profiles;
+        std::vector<const ListenerProfile*> result;
+        result.reserve(profiles.size());
+
+        for(const auto& profile : profiles) {
+            result.push_back(profile.get());
+        }
+
+        std::sort(result.begin(), result.end(), [](const auto lhs, const auto rhs) {
+            return lhs->GetTime() > rhs->GetTime();
+        });
+
+        if(count && count < result.size()) {
+            result.resize(count);
+        }
+
+        return result;
     }
 
-    [[nodiscard]] inline std::uint64_t Engine::GetTimeElapsed() noexcept {
-        return GetTickTime() - MainContext().m_TimeStart;
+    inline void Engine::DumpListenerProfiles(std::size_t count)
+    {
+        for(const auto profile : GetListenerProfiles(count))
+        {
+            const auto& histogram = profile->GetHistogram();
+            if(!histogram.Count()) {
+                continue;
+            }
+
+            Logging::Message<Logging::Benchmark>("[LISTENER: {}] Calls: {}, total: {:.3f} ms, mean: {:.3f} us, "
+                "p50: {:.3f} us, p95: {:.3f} us, p99: {:.3f} us, max: {:.3f} us",
+                profile->GetListener(), histogram.Count(), static_cast<double>(histogram.Sum()) / 1e6, histogram.Mean() / 1e3,
+                static_cast<double>(histogram.Percentile(50.)) / 1e3, static_cast<double>(histogram.Percentile(95.)) / 1e3,
+                static_cast<double>(histogram.Percentile(99.)) / 1e3, static_cast<double>(histogram.Max()) / 1e3);
+        }
+    }
+
+    inline void Engine::ResetListenerProfiles() noexcept
+    {
+        for(auto& profile : MainContext().m_Profiles) {
+            const std::lock_guard lock{profile->m_Lock};
+            profile->m_Histogram.Clear();
+        }
     }
+#endif // HELENA_ENGINE_PROFILER
 
     template <typename HeartbeatConfig>
     requires Engine::RequiresConfig<HeartbeatConfig>
@@ -313,7 +744,11 @@ namespace Helena
         auto& ctx = MainContext();
         const auto state = GetState();
         const auto signal = []<typename... Args, typename... Events>(Signals<Events...>, [[maybe_unused]] Args&&... args) {
-            (SignalEvent<Events>(args...), ...);
+            ([&]() {
+                HELENA_TRACE_SCOPE(Traits::NameOf<Events>, "Phase");
+                StaticSignalEvent<Events>(args...);
+                SignalEvent<Events>(args...);
+            }(), ...);
         };
 
     #if defined(HELENA_PLATFORM_WIN) && defined(HELENA_COMPILER_MSVC)
@@ -324,9 +759,12 @@ namespace Helena
         switch(state)
         {
             case EState::Undefined: [[unlikely]] {
+                StartJobs();
                 ctx.m_TimeStart = GetTickTime();
                 ctx.m_TimeNow   = ctx.m_TimeStart;
                 ctx.m_TimePrev  = ctx.m_TimeStart;
+                ctx.m_TimeAccumulator = 0;
+                ctx.m_FrameStats.m_FrameBegin = 0;
                 ctx.m_ShutdownMessage->m_Location = {};
                 ctx.m_ShutdownMessage->m_Message.clear();
                 ctx.m_State.store(EState::Init, std::memory_order_release);
@@ -334,10 +772,18 @@ namespace Helena
 
             case EState::Init: [[likely]]
             {
+                HELENA_TRACE_SCOPE("Heartbeat", "Engine");
+                auto& stats = ctx.m_FrameStats;
+                const auto frameBegin = GetTickTime();
+                if(stats.m_FrameBegin) {
+                    stats.m_FrameTime.Add(frameBegin - stats.m_FrameBegin);
+                }
+                stats.m_FrameBegin = frameBegin;
+
                 ctx.m_TimePrev  = ctx.m_TimeNow;
-                ctx.m_TimeNow   = GetTickTime();
-                ctx.m_TimeDelta = static_cast<double>(ctx.m_TimeNow - ctx.m_TimePrev) / 1000.;
-                ctx.m_TimeElapsed += ctx.m_TimeDelta;
+                ctx.m_TimeNow   = frameBegin;
+                ctx.m_TimeDelta = static_cast<double>(ctx.m_TimeNow - ctx.m_TimePrev) / 1e9;
+                ctx.m_TimeAccumulator += ctx.m_TimeNow - ctx.m_TimePrev;
 
                 signal(Signals<
                     Events::Engine::PreInit,
@@ -351,9 +797,7 @@ namespace Helena
                     Events::Engine::PostExecute
                 >{});
 
-                for(auto& pair : ctx.m_DeferredSignals) {
-                    pair.Second()(pair.First());
-                } ctx.m_DeferredSignals.clear();
+                DrainDeferred();
 
                 signal(Signals<
                     Events::Engine::PreTick,
@@ -362,23 +806,43 @@ namespace Helena
                 >{}, ctx.m_TimeDelta);
 
                 std::uint32_t accumulated{HeartbeatConfig::Accumulate};
-                while(ctx.m_TimeElapsed >= ctx.m_TickRate && accumulated--) {
-                    ctx.m_TimeElapsed -= ctx.m_TickRate;
+                std::uint32_t steps{};
+                const auto fixedTime = static_cast<double>(ctx.m_TickRate) / 1e9;
+                while(ctx.m_TimeAccumulator >= ctx.m_TickRate && accumulated--) {
+                    ++steps;
+                    ctx.m_TimeAccumulator -= ctx.m_TickRate;
                     signal(Signals<
                         Events::Engine::PreUpdate,
                         Events::Engine::Update,
                         Events::Engine::PostUpdate
-                    >{}, ctx.m_TickRate);
+                    >{}, fixedTime);
                 }
 
-                signal(Signals<
-                    Events::Engine::PreRender,
-                    Events::Engine::Render,
-                    Events::Engine::PostRender
-                >{}, ctx.m_TimeElapsed / ctx.m_TickRate, ctx.m_TimeDelta);
+                if(!ctx.m_GovernorSkipRender) [[likely]] {
+                    signal(Signals<
+                        Events::Engine::PreRender,
+                        Events::Engine::Render,
+                        Events::Engine::PostRender
+                    >{}, static_cast<double>(ctx.m_TimeAccumulator) / static_cast<double>(ctx.m_TickRate), ctx.m_TimeDelta);
+                }
+
+                stats.m_UpdateSteps.Add(steps);
+                stats.m_Lag = ctx.m_TimeAccumulator;
+                stats.m_MaxLag = (std::max)(stats.m_MaxLag, stats.m_Lag);
+                if(ctx.m_TimeAccumulator >= ctx.m_TickRate) {
+                    ++stats.m_Exhausted;
+                }
+
+                const auto workEnd = GetTickTime();
+                stats.m_WorkTime += workEnd - frameBegin;
+
+                if(!ctx.m_Governor.m_Steps.empty()) {
+                    UpdateGovernor(workEnd - frameBegin, ctx.m_TimeAccumulator >= ctx.m_TickRate);
+                }
 
                 if(accumulated) {
                     HeartbeatConfig::Sleep();
+                    stats.m_SleepTime += GetTickTime() - workEnd;
                 }
 
             } break;
@@ -424,8 +888,40 @@ namespace Helena
 
         if(!result)
         {
+            ctx.m_Jobs->Stop();
+
+        #if defined(HELENA_ENGINE_PROFILER)
+            DumpListenerProfiles();
+        #endif
+
+        #if defined(HELENA_TRACER)
+            (void)Types::Tracer::Export();
+        #endif
+
             ctx.m_Signals.Clear();
-            ctx.m_DeferredSignals.clear();
+            ctx.m_KeyedSignals.Clear();
+
+            for(const auto& queue : ctx.m_DeferredQueues) {
+                if(queue) {
+                    queue->Clear();
+                }
+            }
+
+            ctx.m_DeferredOrder.clear();
+            ctx.m_DeferredSequence.clear();
+
+            for(auto queue = ctx.m_ConcurrentQueues.load(std::memory_order_acquire); queue; queue = queue->m_Next) {
+                queue->Drain(false);
+            }
+            ctx.m_DispatchPlans.Clear();
+            ctx.m_StaticDispatch.fill(nullptr);
+            ctx.m_StaticSystems.clear();
+
+        #if defined(HELENA_ENGINE_PROFILER)
+            ctx.m_Profiles.clear();
+        #endif
+
+            ctx.m_Entities.Clear();
             ctx.m_Systems.Clear();
             ctx.m_Components.Clear();
 
@@ -500,6 +996,137 @@ namespace Helena
         SignalEvent<Events::Engine::PostRegisterSystem<T>>();
     }
 
+    template <typename... Systems>
+    requires (sizeof...(Systems) > 0 && (std::is_default_constructible_v<Systems> && ...))
+    void Engine::RegisterSystems()
+    {
+        using Graph = SystemsGraph<Systems...>;
+        static_assert(Traits::UniqueTypes<Systems...>, "Systems are not unique");
+        static_assert(Graph::Acyclic, "Systems have a cyclic dependency");
+
+        if(GetState() == EState::Shutdown) [[unlikely]] return;
+
+        [[maybe_unused]] const auto checkExternal = []<typename... Dependencies>(DependsOn<Dependencies...>) {
+            ([]() {
+                if constexpr(Graph::template External<Dependencies>) {
+                    HELENA_ASSERT(HasSystem<Dependencies>(), "Dependency: {} not registered", Traits::NameOf<Dependencies>);
+                }
+            }(), ...);
+        };
+        [[maybe_unused]] const auto checkRegistered = []<typename System>(std::type_identity<System>) {
+            HELENA_ASSERT(!HasSystem<System>(), "System: {} already registered", Traits::NameOf<System>);
+        };
+        (checkExternal(typename SystemDependencies<Systems>::Type{}), ...);
+        (checkRegistered(std::type_identity<Systems>{}), ...);
+
+        (SignalEvent<Events::Engine::PreRegisterSystem<Systems>>(), ...);
+
+        auto& ctx = MainContext();
+        auto& jobs = *ctx.m_Jobs;
+        std::tuple<Systems*...> instances{};
+        std::array<void*, sizeof...(Systems)> memory{};
+        std::array<std::uint64_t, sizeof...(Systems)> times{};
+        std::array<std::exception_ptr, sizeof...(Systems)> exceptions{};
+        const auto begin = GetTickTime();
+
+        [&]<std::size_t... Index>(std::index_sequence<Index...>)
+        {
+            for(std::size_t wave = 0; wave < Graph::Count; ++wave)
+            {
+                // Constructors can subscribe to the events concurrently
+                ctx.m_ConstructingSystems = true;
+                const auto root = jobs.Create([]{});
+                ([&]() {
+                    if(Graph::template Wave<Index> != wave) {
+                        return;
+                    }
+
+                    // The arena is not thread safe, the memory is reserved before the jobs
+                    using System = std::remove_pointer_t<std::tuple_element_t<Index, decltype(instances)>>;
+                    memory[Index] = ctx.m_Systems.template Reserve<System>();
+
+                    jobs.Run([instance = &std::get<Index>(instances), memory = memory[Index], time = &times[Index], exception = &exceptions[Index], shard = m_ShardContext]() {
+                        // Worker threads use the context of the registering shard
+                        const auto bound = std::exchange(m_ShardContext, shard);
+                        const auto start = GetTickTime();
+                        try {
+                            HELENA_TRACE_SCOPE(Traits::NameOf<System>, "System");
+                            *instance = memory ? ::new (memory) System() : new System();
+                        } catch(...) {
+                            *exception = std::current_exception();
+                        }
+
+                        *time = GetTickTime() - start;
+                        m_ShardContext = bound;
+                    }, root);
+                }(), ...);
+
+                jobs.Schedule(root);
+                jobs.WaitFor(root);
+                ctx.m_ConstructingSystems = false;
+
+                for(const auto& exception : exceptions)
+                {
+                    if(!exception) {
+                        continue;
+                    }
+
+                    // Systems of the wave constructed before the failure are not owned by the container yet
+                    ([&]() {
+                        if(const auto instance = std::get<Index>(instances); instance && Graph::template Wave<Index> == wave) {
+                            if(instance == memory[Index]) {
+                                std::destroy_at(instance);
+                            } else {
+                                delete instance;
+                            }
+                        }
+                    }(), ...);
+
+                    std::rethrow_exception(exception);
+                }
+
+                ([&]() {
+                    if(Graph::template Wave<Index> == wave) {
+                        ctx.m_Systems.Insert(std::get<Index>(instances));
+                        Logging::Message<Logging::Benchmark>("[SYSTEM: {}] Constructed in {:.3f} ms (wave: {})",
+                            Traits::NameOf<Systems>, static_cast<double>(times[Index]) / 1e6, wave);
+                        SignalEvent<Events::Engine::PostRegisterSystem<Systems>>();
+                    }
+                }(), ...);
+            }
+        }(std::index_sequence_for<Systems...>{});
+
+        Logging::Message<Logging::Benchmark>("[SYSTEMS] Registered: {} in {} waves, total: {:.3f} ms",
+            sizeof...(Systems), Graph::Count, static_cast<double>(GetTickTime() - begin) / 1e6);
+    }
+
+    template <typename... T>
+    void Engine::PrefillSystems() {
+        MainContext().m_Systems.template Prefill<T...>();
+    }
+
+    template <typename... T>
+    void Engine::PrefillComponents() {
+        MainContext().m_Components.template Prefill<T...>();
+    }
+
+    template <typename... T>
+    void Engine::PrefillEvents()
+    {
+        auto& ctx = MainContext();
+        ctx.m_Signals.template Prefill<T...>();
+        ctx.m_KeyedSignals.template Prefill<T...>();
+        ctx.m_DispatchPlans.template Prefill<T...>();
+        ctx.m_DeferredIndexer.template Prefill<T...>();
+    }
+
+    inline void Engine::EnableArenaStorage()
+    {
+        auto& ctx = MainContext();
+        ctx.m_Systems.EnableArena();
+        ctx.m_Components.EnableArena();
+    }
+
     template <typename... T>
     [[nodiscard]] bool Engine::HasSystem() {
         return MainContext().m_Systems.template Has<T...>();
@@ -516,8 +1143,21 @@ namespace Helena
     }
 
     template <typename... T>
-    void Engine::RemoveSystem(decltype(NoSignal)) {
-        MainContext().m_Systems.template Remove<T...>();
+    void Engine::RemoveSystem(decltype(NoSignal))
+    {
+        // The static dispatch keeps the pointers to the static systems until the shutdown
+        auto& ctx = MainContext();
+        ([&]() {
+            if(ctx.m_StaticSystems.empty() || !ctx.m_Systems.template Has<T>()) {
+                return;
+            }
+
+            const auto system = static_cast<void*>(std::addressof(ctx.m_Systems.template Get<T>()));
+            HELENA_ASSERT_RUNTIME(std::find(ctx.m_StaticSystems.cbegin(), ctx.m_StaticSystems.cend(), system) == ctx.m_StaticSystems.cend(),
+                "System: {} is static, it can't be removed", Traits::NameOf<T>);
+        }(), ...);
+
+        ctx.m_Systems.template Remove<T...>();
     }
 
     template <typename... T>
@@ -584,36 +1224,176 @@ namespace Helena
         } else (RemoveComponent<T>(), ...);
     }
 
-    template <typename Event, auto Callback>
-    requires Engine::RequiresCallback<Event, Callback, /* Member function */ false>
-    void Engine::SubscribeEvent() {
-        return SubscribeEvent(typename Delegate::Args<Event, Callback>{}, nullptr);
+    template <typename T>
+    void Engine::EntitySignals::Attach(Types::Entity entity) {
+        SignalEvent<Events::Engine::AttachComponent<T>>(entity);
     }
 
-    template <typename Event, auto Callback>
-    requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
-    void Engine::SubscribeEvent(typename Traits::Function<decltype(Callback)>::Class* instance) {
-        return SubscribeEvent(typename Delegate::Args<Event, Callback>{}, instance);
+    template <typename T>
+    void Engine::EntitySignals::Detach(Types::Entity entity) {
+        SignalEvent<Events::Engine::DetachComponent<T>>(entity);
     }
 
-    template <typename Event, auto Callback>
-    requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
-    void Engine::SubscribeEvent(Delegate::Args<Event, Callback>, void* instance)
+    [[nodiscard]] inline Engine::EntityRegistry& Engine::GetEntities() {
+        return MainContext().m_Entities;
+    }
+
+    template <typename... T, typename Callback>
+    void Engine::ParallelEach(const Types::EntityView<T...>& view, Callback&& callback, std::size_t grainSize)
     {
-        auto& ctx = MainContext();
+        static_assert(RequiresParallelCallback<Callback, Types::EntityView<T...>, T...>,
+            "Callback signature: void(Entity, T&...), void(T&...), void(IMemoryResource*, Entity, T&...) or void(IMemoryResource*, T&...)");
+        HELENA_ASSERT(grainSize, "Grain size is zero");
+
+        const auto size = view.SizeHint();
+        if(!size) {
+            return;
+        }
+
+        // Bounds of chunks depend only on the size of the view and the grain
+        const auto grain = (std::max)(grainSize, (size + m_MaxChunks - 1) / m_MaxChunks);
+        const auto chunks = (size + grain - 1) / grain;
+
+        struct Failure {
+            std::exception_ptr m_Exception;
+            std::size_t m_Chunk;
+            Types::Spinlock m_Lock;
+        } failure{nullptr, chunks, {}};
+
+        const auto execute = [&](std::size_t chunk) noexcept
+        {
+            Types::StackAllocator<m_ScratchSize> scratch{Types::DefaultAllocator::Get()};
+            const auto first = chunk * grain;
+            const auto last = (std::min)(first + grain, size);
+
+            try {
+                view.Each(first, last, [&](Types::Entity entity, auto&&... components) {
+                    if constexpr(std::invocable<Callback&, Types::Entity, decltype(components)...>) {
+                        callback(entity, std::forward<decltype(components)>(components)...);
+                    } else if constexpr(std::invocable<Callback&, decltype(components)...>) {
+                        callback(std::forward<decltype(components)>(components)...);
+                    } else if constexpr(std::invocable<Callback&, Types::IMemoryResource*, Types::Entity, decltype(components)...>) {
+                        callback(static_cast<Types::IMemoryResource*>(&scratch), entity, std::forward<decltype(components)>(components)...);
+                    } else {
+                        callback(static_cast<Types::IMemoryResource*>(&scratch), std::forward<decltype(components)>(components)...);
+                    }
+                });
+            } catch(...) {
+                const std::lock_guard lock{failure.m_Lock};
+                if(chunk < failure.m_Chunk) {
+                    failure.m_Exception = std::current_exception();
+                    failure.m_Chunk = chunk;
+                }
+            }
+        };
+
+        auto& jobs = *MainContext().m_Jobs;
+        if(chunks == 1 || !jobs.Running()) {
+            for(std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                execute(chunk);
+            }
+        } else {
+            const auto root = jobs.Create([]{});
+            for(std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                jobs.Run([&execute, chunk, shard = m_ShardContext]() {
+                    // Worker threads use the context of the calling shard
+                    const auto bound = std::exchange(m_ShardContext, shard);
+                    execute(chunk);
+                    m_ShardContext = bound;
+                }, root);
+            }
+
+            jobs.Schedule(root);
+            jobs.WaitFor(root);
+        }
+
+        if(failure.m_Exception) {
+            std::rethrow_exception(failure.m_Exception);
+        }
+    }
+
+    template <typename Event, auto Callback>
+    requires Engine::RequiresCallback<Event, Callback, /* Member function */ false>
+    Engine::Subscription Engine::SubscribeEvent() {
+        return SubscribeEvent(typename Delegate::Args<Event, Callback>{}, nullptr);
+    }
+
+    template <typename Event, auto Callback>
+    requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
+    Engine::Subscription Engine::SubscribeEvent(typename Traits::Function<decltype(Callback)>::Class* instance) {
+        return SubscribeEvent(typename Delegate::Args<Event, Callback>{}, instance);
+    }
+
+    template <typename Event, auto Callback, typename... R, typename... W>
+    requires Engine::RequiresCallback<Event, Callback, /* Member function */ false>
+    Engine::Subscription Engine::SubscribeEvent(Reads<R...>, Writes<W...>) {
+        return SubscribeEvent(typename Delegate::Args<Event, Callback>{}, nullptr, &Access<Reads<R...>, Writes<W...>>::m_Info);
+    }
+
+    template <typename Event, auto Callback, typename... R, typename... W>
+    requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
+    Engine::Subscription Engine::SubscribeEvent(typename Traits::Function<decltype(Callback)>::Class* instance, Reads<R...>, Writes<W...>) {
+        return SubscribeEvent(typename Delegate::Args<Event, Callback>{}, instance, &Access<Reads<R...>, Writes<W...>>::m_Info);
+    }
+
+    template <typename Event, auto Callback>
+    requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+    Engine::Subscription Engine::SubscribeEvent(Delegate::Args<Event, Callback>, void* instance, const AccessInfo* access)
+    {
+        auto& ctx = MainContext();
+        const auto lock = LockSignals(ctx);
         if(!ctx.m_Signals.template Has<Event>()) {
             ctx.m_Signals.template Create<Event>();
         }
 
-        auto& pool = ctx.m_Signals.template Get<Event>();
+        const auto serial = ++ctx.m_SignalsSerial;
+        const auto slot = SubscribeEvent<Event, Callback>(ctx.m_Signals.template Get<Event>(), serial, instance, access);
+        return Subscription{&Engine::UnsubscribeEvent<Event>, slot, serial};
+    }
+
+    template <typename Event, auto Callback>
+    requires Engine::RequiresCallback<Event, Callback, /* Member function */ false>
+    Engine::Subscription Engine::SubscribeEvent(Key key) {
+        return SubscribeEvent(key, typename Delegate::Args<Event, Callback>{}, nullptr);
+    }
+
+    template <typename Event, auto Callback>
+    requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
+    Engine::Subscription Engine::SubscribeEvent(Key key, typename Traits::Function<decltype(Callback)>::Class* instance) {
+        return SubscribeEvent(key, typename Delegate::Args<Event, Callback>{}, instance);
+    }
+
+    template <typename Event, auto Callback>
+    Engine::Subscription Engine::SubscribeEvent(Key key, Delegate::Args<Event, Callback>, void* instance)
+    {
+        auto& ctx = MainContext();
+        const auto lock = LockSignals(ctx);
+        if(!ctx.m_KeyedSignals.template Has<Event>()) {
+            ctx.m_KeyedSignals.template Create<Event>();
+        }
+
+        const auto serial = ++ctx.m_SignalsSerial;
+        const auto slot = SubscribeEvent<Event, Callback>(ctx.m_KeyedSignals.template Get<Event>().Get(key.m_Value), serial, instance, nullptr);
+        return Subscription{&Engine::UnsubscribeKeyedEvent<Event>, slot, serial, key.m_Value};
+    }
+
+    template <typename Event, auto Callback>
+    std::uint32_t Engine::SubscribeEvent(Listeners& pool, std::uint64_t serial, void* instance, const AccessInfo* access)
+    {
     #if defined(HELENA_DEBUG)
-        [[maybe_unused]]
-        const auto empty = pool.cend() == std::find_if(pool.cbegin(), pool.cend(), [instance](const auto& delegate) {
-            return delegate.template Compare<Event, Callback>(instance);
-        });
+        [[maybe_unused]] bool empty = true;
+        for(std::size_t pos = 0; pos < pool.Slots() && empty; ++pos) {
+            empty = !pool[pos] || !pool[pos].template Compare<Event, Callback>(instance);
+        }
         HELENA_ASSERT(empty, "Listener: {} already registered!", Traits::NameOf<decltype(Callback)>);
     #endif
-        pool.emplace_back(typename Delegate::Args<Event, Callback>{}, instance);
+
+        Delegate delegate{typename Delegate::Args<Event, Callback>{}, instance, access};
+    #if defined(HELENA_ENGINE_PROFILER)
+        delegate.Profile(GetListenerProfile(Traits::NameOf<Event>, Traits::NameOf<typename Delegate::Args<Event, Callback>>));
+    #endif
+
+        return pool.Subscribe(delegate, serial);
     }
 
     template <typename... Event>
@@ -622,7 +1402,7 @@ namespace Helena
     {
         const auto& ctx = MainContext();
         if constexpr(Traits::Arguments<Event...>::Single) {
-            return ctx.m_Signals.template Has<Event...>() ? ctx.m_Signals.template Get<Event...>().size() : 0;
+            return ctx.m_Signals.template Has<Event...>() ? ctx.m_Signals.template Get<Event...>().Size() : 0;
         } else {
             return std::make_tuple(Subscribers<Event>()...);
         }
@@ -635,7 +1415,7 @@ namespace Helena
         const auto& ctx = MainContext();
         if constexpr(Traits::Arguments<Event...>::Single) {
             if(ctx.m_Signals.template Has<Event...>()) [[likely]] {
-                return !ctx.m_Signals.template Get<Event...>().empty();
+                return !ctx.m_Signals.template Get<Event...>().Empty();
             }
             return false;
         } else {
@@ -654,7 +1434,7 @@ namespace Helena
     void Engine::SignalEvent([[maybe_unused]] Args&&... args)
     {
         auto pool = MainContext().m_Signals.template Ptr<Event>();
-        const auto listeners = pool && !pool->empty();
+        const auto listeners = pool && !pool->Empty();
 
         if(listeners) [[likely]]
         {
@@ -686,20 +1466,188 @@ namespace Helena
 
     template <typename Event>
     requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
-    void Engine::SignalEvent(EventsPool<Delegate>& pool, Event& event)
+    void Engine::SignalEvent(Listeners& pool, Event& event)
     {
-        for(std::size_t pos = pool.size(); pos; --pos) {
-            const auto& delegate = pool[pos - 1];
-            std::invoke(delegate, &event);
+        if constexpr(Traits::AnyOf<Event,
+            Events::Engine::PreTick,        Events::Engine::Tick,       Events::Engine::PostTick,
+            Events::Engine::PreUpdate,      Events::Engine::Update,     Events::Engine::PostUpdate,
+            Events::Engine::PreRender,      Events::Engine::Render,     Events::Engine::PostRender>) {
+            auto& ctx = MainContext();
+            if(ctx.m_Dispatch == EDispatch::Parallel && pool.Size() > 1
+                && !ctx.m_Dispatching.exchange(true, std::memory_order_acquire)) {
+                // Nested signals from listeners use the serial dispatch
+                const struct Guard {
+                    ~Guard() { m_Flag.store(false, std::memory_order_release); }
+                    std::atomic<bool>& m_Flag;
+                } guard{ctx.m_Dispatching};
+                return ParallelSignalEvent(pool, event);
+            }
         }
 
+        SerialSignalEvent(pool, event);
+
         if constexpr(Traits::AnyOf<Event,
             Events::Engine::PreInit,        Events::Engine::Init,       Events::Engine::PostInit,
             Events::Engine::PreConfig,      Events::Engine::Config,     Events::Engine::PostConfig,
             Events::Engine::PreExecute,     Events::Engine::Execute,    Events::Engine::PostExecute,
             Events::Engine::PreFinalize,    Events::Engine::Finalize,   Events::Engine::PostFinalize,
             Events::Engine::PreShutdown,    Events::Engine::Shutdown,   Events::Engine::PostShutdown>) {
-            pool.clear();
+            pool.Clear();
+        }
+    }
+
+    template <typename Event>
+    void Engine::SerialSignalEvent(Listeners& pool, Event& event)
+    {
+        // Listeners can subscribe and unsubscribe: the pool grows only at the end
+        // and the compaction is deferred, the delegate is copied before the call
+        pool.Lock();
+        const struct Guard {
+            ~Guard() { m_Pool.Unlock(); }
+            Listeners& m_Pool;
+        } guard{pool};
+
+        for(std::size_t pos = pool.Slots(); pos; --pos) {
+            if(const auto delegate = pool[pos - 1]) {
+                std::invoke(delegate, &event);
+            }
+        }
+    }
+
+    template <typename Event, typename... Args>
+    requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+    void Engine::SignalEvent(Key key, [[maybe_unused]] Args&&... args)
+    {
+        const auto keyed = MainContext().m_KeyedSignals.template Ptr<Event>();
+        const auto pool = keyed ? keyed->Find(key.m_Value) : nullptr;
+        if(!pool || pool->Empty()) {
+            return;
+        }
+
+        if constexpr(std::is_empty_v<Event>) {
+            union { Event event; };
+            SerialSignalEvent(*pool, event);
+        } else if constexpr(requires {Event(std::forward<Args>(args)...); }) {
+            Event event(std::forward<Args>(args)...);
+            SerialSignalEvent(*pool, event);
+        } else if constexpr(requires {Event{std::forward<Args>(args)...}; }) {
+            Event event{std::forward<Args>(args)...};
+            SerialSignalEvent(*pool, event);
+        } else {
+            [] <bool Constructible = false>() {
+                static_assert(Constructible, "Event type not constructible from args");
+            }();
+        }
+
+        // The listeners of the key unsubscribed during the dispatch
+        keyed->Release(key.m_Value);
+    }
+
+    template <typename Event>
+    requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+    void Engine::ParallelSignalEvent(Listeners& pool, Event& event)
+    {
+        auto& ctx = MainContext();
+        if(!ctx.m_DispatchPlans.template Has<Event>()) {
+            ctx.m_DispatchPlans.template Create<Event>();
+        }
+
+        auto& plan = ctx.m_DispatchPlans.template Get<Event>();
+        if(plan.m_Revision != pool.Revision()) {
+            BuildDispatchPlan(pool, plan);
+            plan.m_Revision = pool.Revision();
+        }
+
+        pool.Lock();
+        const struct Guard {
+            ~Guard() { m_Pool.Unlock(); }
+            Listeners& m_Pool;
+        } guard{pool};
+
+        auto& jobs = *ctx.m_Jobs;
+        std::exception_ptr exception{};
+        Types::Spinlock lock{};
+
+        for(std::size_t wave = 0; wave < plan.m_Waves.size(); ++wave)
+        {
+            const std::size_t begin = plan.m_Waves[wave];
+            const std::size_t end = wave + 1 < plan.m_Waves.size() ? plan.m_Waves[wave + 1] : plan.m_Order.size();
+
+            if(end - begin == 1) {
+                const auto delegate = pool[plan.m_Order[begin]];
+                std::invoke(delegate, &event);
+                continue;
+            }
+
+            const auto root = jobs.Create([]{});
+            for(auto pos = begin; pos < end; ++pos) {
+                jobs.Run([&exception, &lock, &event, delegate = &pool[plan.m_Order[pos]], shard = m_ShardContext]() {
+                    // Worker threads use the context of the dispatching shard
+                    const auto bound = std::exchange(m_ShardContext, shard);
+                    try {
+                        std::invoke(*delegate, &event);
+                    } catch(...) {
+                        const std::lock_guard guard{lock};
+                        if(!exception) {
+                            exception = std::current_exception();
+                        }
+                    }
+
+                    m_ShardContext = bound;
+                }, root);
+            }
+
+            jobs.Schedule(root);
+            jobs.WaitFor(root);
+
+            if(exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+
+    template <typename Event>
+    requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+    void Engine::SignalEvents(std::span<Event> events)
+    {
+        if(const auto pool = MainContext().m_Signals.template Ptr<Event>(); pool && !pool->Empty() && !events.empty()) [[likely]] {
+            SignalEvents(*pool, events);
+        }
+    }
+
+    template <typename Event>
+    requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+    void Engine::SignalEvents(Listeners& pool, std::span<Event> events)
+    {
+        if constexpr(requires { Internal::StaticListener<Event>::Index; }) {
+            // Engine events keep the dispatch modes and the one-shot semantics of SignalEvent
+            for(auto& event : events) {
+                SignalEvent(pool, event);
+            }
+        } else {
+            pool.Lock();
+            const struct Guard {
+                ~Guard() { m_Pool.Unlock(); }
+                Listeners& m_Pool;
+            } guard{pool};
+
+            // Listener-major order: each listener receives the whole batch in one loop
+            for(std::size_t slot = pool.Slots(); slot; --slot)
+            {
+                const auto delegate = pool[slot - 1];
+                if(!delegate) {
+                    continue;
+                }
+
+                if(delegate.Batched()) {
+                    delegate(static_cast<void*>(events.data()), events.size());
+                    continue;
+                }
+
+                for(std::size_t pos = 0; pos < events.size() && pool[slot - 1]; ++pos) {
+                    std::invoke(delegate, &events[pos]);
+                }
+            }
         }
     }
 
@@ -707,12 +1655,246 @@ namespace Helena
     requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
     void Engine::EnqueueSignal(Args&&... args)
     {
-        MainContext().m_DeferredSignals.emplace_back(std::piecewise_construct,
-            std::forward_as_tuple(std::in_place_type<Event>, std::forward<Args>(args)...),
-            std::forward_as_tuple([](DeferredCtx& data) {
-                const auto event = data.template As<Event*>();
-                SignalEvent(*event);
-            }));
+        auto& ctx = MainContext();
+        const auto index = ctx.m_DeferredIndexer.template Get<Event>();
+        if(index >= ctx.m_DeferredQueues.size()) {
+            ctx.m_DeferredQueues.resize(index + 1u);
+        }
+
+        auto& queue = ctx.m_DeferredQueues[index];
+        if(!queue) {
+            queue = std::make_unique<DeferredEvents<Event>>();
+        }
+
+        static_cast<DeferredEvents<Event>&>(*queue).Push(std::forward<Args>(args)...);
+
+        if(!queue->m_Queued) {
+            queue->m_Queued = true;
+            ctx.m_DeferredOrder.push_back(queue.get());
+        }
+
+        if(ctx.m_Deferred == EDeferred::Strict) {
+            ctx.m_DeferredSequence.push_back(queue.get());
+        }
+    }
+
+    inline void Engine::DrainDeferred()
+    {
+        HELENA_TRACE_SCOPE("DrainDeferred", "Engine");
+        auto& ctx = MainContext();
+        for(auto queue = ctx.m_ConcurrentQueues.load(std::memory_order_acquire); queue; queue = queue->m_Next) {
+            queue->Drain(true);
+        }
+
+        if(ctx.m_DeferredOrder.empty()) {
+            return;
+        }
+
+        // Events enqueued by listeners go to the emptied lists and wait for the next frame
+        auto& drain = ctx.m_DeferredDrain;
+        auto& sequence = ctx.m_DeferredDrainSequence;
+        drain.swap(ctx.m_DeferredOrder);
+        sequence.swap(ctx.m_DeferredSequence);
+
+        const struct Guard {
+            ~Guard() {
+                m_Drain.clear();
+                m_Sequence.clear();
+            }
+
+            std::vector<DeferredQueue*>& m_Drain;
+            std::vector<DeferredQueue*>& m_Sequence;
+        } guard{drain, sequence};
+
+        for(const auto queue : drain) {
+            queue->Swap();
+        }
+
+        // Strict order is kept for the events enqueued in EDeferred::Strict mode,
+        // the rest of events (mode changed during the frame) are dispatched in batches
+        for(const auto queue : sequence) {
+            queue->SignalNext();
+        }
+
+        for(const auto queue : drain) {
+            queue->SignalAll();
+        }
+    }
+
+    template <typename Event, typename... Args>
+    requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+    void Engine::EnqueueSignalConcurrent(Args&&... args) {
+        GetConcurrentQueue(MainContext()).template Push<Event>(std::forward<Args>(args)...);
+    }
+
+    template <typename Event, typename... Args>
+    requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
+    bool Engine::PostSignal(const Mailbox& mailbox, Args&&... args)
+    {
+        HELENA_ASSERT(mailbox.m_State, "Mailbox is empty");
+        const auto context = mailbox.m_State ? mailbox.m_State->Enter() : nullptr;
+        if(!context) [[unlikely]] {
+            return false;
+        }
+
+        const struct Guard {
+            ~Guard() {
+                m_State.Leave();
+            }
+
+            MailboxState& m_State;
+        } guard{*mailbox.m_State};
+
+        GetConcurrentQueue(*context).template Push<Event>(std::forward<Args>(args)...);
+        return true;
+    }
+
+    [[nodiscard]] inline Engine::ConcurrentQueue& Engine::GetConcurrentQueue(Context& ctx)
+    {
+        static thread_local ConcurrentProducer producer{};
+        auto& targets = producer.m_Targets;
+
+        for(std::size_t pos = 0; pos < targets.size(); ++pos)
+        {
+            if(targets[pos].m_Context != std::addressof(ctx)) {
+                continue;
+            }
+
+            if(!targets[pos].m_Queue->m_Detached.load(std::memory_order_acquire)) [[likely]] {
+                return *targets[pos].m_Queue;
+            }
+
+            // The context was destroyed, the address is reused by the new one
+            ConcurrentQueue::Release(targets[pos].m_Queue);
+            targets.erase(targets.begin() + static_cast<std::ptrdiff_t>(pos));
+            break;
+        }
+
+        // Reuse the queue released by a finished thread
+        auto& head = ctx.m_ConcurrentQueues;
+        for(auto queue = head.load(std::memory_order_acquire); queue; queue = queue->m_Next)
+        {
+            if(bool owned{}; queue->m_Owned.compare_exchange_strong(owned, true, std::memory_order_acquire)) {
+                queue->m_References.fetch_add(1, std::memory_order_relaxed);
+                return *targets.emplace_back(std::addressof(ctx), queue).m_Queue;
+            }
+        }
+
+        // References: context and producer thread
+        const auto queue = new ConcurrentQueue{};
+        queue->m_Owned.store(true, std::memory_order_relaxed);
+        queue->m_References.store(2, std::memory_order_relaxed);
+        queue->m_Next = head.load(std::memory_order_relaxed);
+        while(!head.compare_exchange_weak(queue->m_Next, queue, std::memory_order_release, std::memory_order_relaxed));
+
+        return *targets.emplace_back(std::addressof(ctx), queue).m_Queue;
+    }
+
+    template <typename Event, typename... Args>
+    void Engine::ConcurrentQueue::Push(Args&&... args)
+    {
+        if(m_Write == m_BlockSize)
+        {
+            auto block = m_Spare.exchange(nullptr, std::memory_order_acquire);
+            if(!block) {
+                block = new Block;
+            }
+
+            m_Tail->m_Next.store(block, std::memory_order_release);
+            m_Tail = block;
+            m_Write = 0;
+        }
+
+        auto& entry = m_Tail->m_Entries[m_Write];
+        entry.m_Event.template Create<Event>(std::forward<Args>(args)...);
+        entry.m_Enqueue = [](Storage& storage) {
+            EnqueueSignal<Event>(std::move(storage.template As<Event&>()));
+        };
+
+        m_Tail->m_Count.store(++m_Write, std::memory_order_release);
+    }
+
+    inline void Engine::ConcurrentQueue::Drain(bool enqueue)
+    {
+        while(true)
+        {
+            const auto count = m_Head->m_Count.load(std::memory_order_acquire);
+            for(; m_Read < count; ++m_Read)
+            {
+                auto& entry = m_Head->m_Entries[m_Read];
+                if(enqueue) {
+                    entry.m_Enqueue(entry.m_Event);
+                }
+
+                entry.m_Event.Reset();
+            }
+
+            if(m_Read < m_BlockSize) {
+                break;
+            }
+
+            const auto next = m_Head->m_Next.load(std::memory_order_acquire);
+            if(!next) {
+                break;
+            }
+
+            // The producer has moved to the next block
+            const auto block = std::exchange(m_Head, next);
+            block->m_Count.store(0, std::memory_order_relaxed);
+            block->m_Next.store(nullptr, std::memory_order_relaxed);
+            m_Read = 0;
+
+            delete m_Spare.exchange(block, std::memory_order_acq_rel);
+        }
+    }
+
+    template <typename Event>
+    template <typename... Args>
+    void Engine::DeferredEvents<Event>::Push(Args&&... args)
+    {
+        if constexpr(requires { Event(std::forward<Args>(args)...); }) {
+            m_Events.emplace_back(std::forward<Args>(args)...);
+        } else {
+            m_Events.push_back(Event{std::forward<Args>(args)...});
+        }
+    }
+
+    template <typename Event>
+    void Engine::DeferredEvents<Event>::Swap() noexcept
+    {
+        m_Drain.clear();
+        m_Drain.swap(m_Events);
+        m_Cursor = 0;
+        m_Queued = false;
+    }
+
+    template <typename Event>
+    void Engine::DeferredEvents<Event>::SignalNext()
+    {
+        if(m_Cursor < m_Drain.size()) {
+            SignalEvent(m_Drain[m_Cursor++]);
+        }
+    }
+
+    template <typename Event>
+    void Engine::DeferredEvents<Event>::SignalAll()
+    {
+        const auto begin = m_Cursor;
+        const auto end = m_Drain.size();
+        m_Cursor = end;
+
+        if(begin < end) {
+            SignalEvents(std::span<Event>{m_Drain.data() + begin, end - begin});
+        }
+    }
+
+    template <typename Event>
+    void Engine::DeferredEvents<Event>::Clear() noexcept
+    {
+        m_Events.clear();
+        m_Drain.clear();
+        m_Cursor = 0;
+        m_Queued = false;
     }
 
     template <typename Event, auto Callback>
@@ -731,15 +1913,74 @@ namespace Helena
     requires Traits::SameAs<Event, Traits::RemoveCVRP<Event>>
     void Engine::UnsubscribeEvent(Delegate::Args<Event, Callback>, void* instance)
     {
-        if(const auto pool = MainContext().m_Signals.template Ptr<Event>())
-        {
-            const auto it = std::find_if(pool->cbegin(), pool->cend(), [instance](const auto& delegate) {
-                return delegate.template Compare<Event, Callback>(instance);
-            });
+        auto& ctx = MainContext();
+        const auto lock = LockSignals(ctx);
+        if(const auto pool = ctx.m_Signals.template Ptr<Event>()) {
+            pool->template Unsubscribe<Event, Callback>(instance);
+        }
+    }
 
-            if(it != pool->cend()) {
-                pool->erase(it);
-            };
+    template <typename Event, auto Callback>
+    requires Engine::RequiresCallback<Event, Callback, /* Member function */ false>
+    void Engine::UnsubscribeEvent(Key key) {
+        return UnsubscribeEvent(key, typename Delegate::Args<Event, Callback>{}, nullptr);
+    }
+
+    template <typename Event, auto Callback>
+    requires Engine::RequiresCallback<Event, Callback, /* Member function */ true>
+    void Engine::UnsubscribeEvent(Key key, typename Traits::Function<decltype(Callback)>::Class* instance) {
+        return UnsubscribeEvent(key, typename Delegate::Args<Event, Callback>{}, instance);
+    }
+
+    template <typename Event, auto Callback>
+    void Engine::UnsubscribeEvent(Key key, Delegate::Args<Event, Callback>, void* instance)
+    {
+        auto& ctx = MainContext();
+        const auto lock = LockSignals(ctx);
+        if(const auto keyed = ctx.m_KeyedSignals.template Ptr<Event>()) {
+            if(const auto pool = keyed->Find(key.m_Value); pool && pool->template Unsubscribe<Event, Callback>(instance)) {
+                keyed->Release(key.m_Value);
+            }
+        }
+    }
+
+    template <typename Event>
+    void Engine::UnsubscribeEvent(const Subscription& subscription)
+    {
+        auto& ctx = MainContext();
+        const auto lock = LockSignals(ctx);
+        if(const auto pool = ctx.m_Signals.template Ptr<Event>()) {
+            pool->Unsubscribe(subscription.m_Slot, subscription.m_Serial);
+        }
+    }
+
+    template <typename Event>
+    void Engine::UnsubscribeKeyedEvent(const Subscription& subscription)
+    {
+        auto& ctx = MainContext();
+        const auto lock = LockSignals(ctx);
+        if(const auto keyed = ctx.m_KeyedSignals.template Ptr<Event>()) {
+            if(const auto pool = keyed->Find(subscription.m_Key); pool && pool->Unsubscribe(subscription.m_Slot, subscription.m_Serial)) {
+                keyed->Release(subscription.m_Key);
+            }
+        }
+    }
+
+    [[nodiscard]] inline std::unique_lock<Types::Spinlock> Engine::LockSignals(Context& ctx)
+    {
+        std::unique_lock lock{ctx.m_SignalsLock, std::defer_lock};
+        if(ctx.m_ConstructingSystems) {
+            lock.lock();
+        }
+
+        return lock;
+    }
+
+    inline void Engine::UnsubscribeEvent(Subscription& subscription)
+    {
+        if(subscription) {
+            subscription.m_Unsubscribe(subscription);
+            subscription = {};
         }
     }
 }
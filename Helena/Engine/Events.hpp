@@ -1,6 +1,10 @@
 #ifndef HELENA_ENGINE_EVENTS_HPP
 #define HELENA_ENGINE_EVENTS_HPP
 
+#include <Helena/Types/Entity.hpp>
+
+#include <cstdint>
+
 namespace Helena::Events::Engine
 {
     struct PreInit {};
@@ -42,6 +46,14 @@ namespace Helena::Events::Engine
     struct Shutdown {};
     struct PostShutdown {};
 
+    //! Overload governor changed the level (see: Engine::SetGovernor)
+    struct GovernorTransition {
+        std::uint32_t previous;
+        std::uint32_t level;
+        double tickrate;
+        bool skipRender;
+    };
+
     template <typename>
     struct PreRegisterSystem {};
 
@@ -65,6 +77,18 @@ namespace Helena::Events::Engine
 
     template <typename>
     struct PostRemoveComponent {};
+
+    //! Component is added to the entity (see: Engine::GetEntities)
+    template <typename>
+    struct AttachComponent {
+        Types::Entity entity;
+    };
+
+    //! Component will be removed from the entity, it's still accessible
+    template <typename>
+    struct DetachComponent {
+        Types::Entity entity;
+    };
 }
 
 #endif // HELENA_ENGINE_EVENTS_HPP
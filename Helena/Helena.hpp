@@ -47,6 +47,7 @@
 #include <Helena/Traits/Constness.hpp>
 #include <Helena/Traits/Constructible.hpp>
 #include <Helena/Traits/FNV1a.hpp>
+#include <Helena/Traits/Fields.hpp>
 #include <Helena/Traits/Function.hpp>
 #include <Helena/Traits/Identity.hpp>
 #include <Helena/Traits/NameOf.hpp>
@@ -70,13 +71,19 @@
 #include <Helena/Types/DateTime.hpp>
 #include <Helena/Types/Delegate.hpp>
 #include <Helena/Types/EncryptedString.hpp>
+#include <Helena/Types/Entity.hpp>
+#include <Helena/Types/EntityRegistry.hpp>
+#include <Helena/Types/EntitySet.hpp>
 #include <Helena/Types/FixedBuffer.hpp>
 #include <Helena/Types/Function.hpp>
 #include <Helena/Types/Hash.hpp>
+#include <Helena/Types/Histogram.hpp>
+#include <Helena/Types/JobSystem.hpp>
 #include <Helena/Types/LocationString.hpp>
 #include <Helena/Types/Monostate.hpp>
 #include <Helena/Types/Mutex.hpp>
 #include <Helena/Types/Overloads.hpp>
+#include <Helena/Types/SoAPool.hpp>
 #include <Helena/Types/ReferencePointer.hpp>
 #include <Helena/Types/RWLock.hpp>
 #include <Helena/Types/SourceLocation.hpp>
@@ -87,9 +94,11 @@
 #include <Helena/Types/System.hpp>
 #include <Helena/Types/TaskScheduler.hpp>
 #include <Helena/Types/TimeSpan.hpp>
+#include <Helena/Types/Tracer.hpp>
 #include <Helena/Types/UniqueIndexer.hpp>
 #include <Helena/Types/VectorAny.hpp>
 #include <Helena/Types/VectorKVAny.hpp>
+#include <Helena/Types/VectorPaged.hpp>
 #include <Helena/Types/VectorUnique.hpp>
 
 // Util
@@ -10,6 +10,7 @@
 #include <Helena/Types/DateTime.hpp>
 #include <Helena/Types/VectorUnique.hpp>
 #include <Helena/Types/Spinlock.hpp>
+#include <Helena/Types/Tracer.hpp>
 #include <Helena/Util/Process.hpp>
 #include <Helena/Util/String.hpp>
 
@@ -242,6 +243,7 @@ namespace Helena::Logging
 
         void RunWorker()
         {
+            HELENA_TRACE_THREAD("FileLogger");
             while(!m_Stop)
             {
                 m_Semaphore.acquire();
@@ -259,8 +261,10 @@ namespace Helena::Logging
 
                 if(auto file = std::invoke(fileFn, this, buffer.size()))
                 {
+                    HELENA_TRACE_SCOPE("FileLogger::Write", "Logging");
                     std::fwrite(buffer.data(), 1, buffer.size(), file);
                     if(size == 1) {
+                        HELENA_TRACE_SCOPE("FileLogger::Flush", "Logging");
                         std::fflush(file);
                     }
                 }
@@ -11,6 +11,8 @@
 
 /* ----------- [Utility] ----------- */
 #define HELENA_STRINGIFY(str)                   #str
+#define HELENA_CONCAT_IMPL(lhs, rhs)            lhs##rhs
+#define HELENA_CONCAT(lhs, rhs)                 HELENA_CONCAT_IMPL(lhs, rhs)
 
 /* ----------- [Diagnostic Pragma] ----------- */
 #if defined(HELENA_COMPILER_CLANG)
@@ -14,6 +14,7 @@
     #include <netinet/tcp.h>
     #include <netdb.h>
     #include <signal.h>
+    #include <time.h>
     #include <dlfcn.h>
     #include <unistd.h>
     #include <errno.h>
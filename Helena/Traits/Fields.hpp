@@ -0,0 +1,113 @@
+#ifndef HELENA_TRAITS_FIELDS_HPP
+#define HELENA_TRAITS_FIELDS_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Helena::Traits
+{
+    namespace Internal
+    {
+        //! Converts to any type of field, used to count the fields of aggregate
+        struct AnyField {
+            template <typename T>
+            constexpr operator T() const noexcept;
+        };
+
+        template <typename T, typename... Fields>
+        [[nodiscard]] consteval std::size_t CountFields() noexcept
+        {
+            if constexpr(requires { T{std::declval<Fields>()..., std::declval<AnyField>()}; }) {
+                return CountFields<T, Fields..., AnyField>();
+            } else {
+                return sizeof...(Fields);
+            }
+        }
+
+        template <typename... Field>
+        std::tuple<std::remove_reference_t<Field>...> RemoveReferences(std::tuple<Field...>);
+    }
+
+    /**
+    * @brief Count of fields of the aggregate
+    * @note Fields must not be aggregates themselves: brace elision would count
+    * the fields of the nested aggregate (e.g. std::array or C array).
+    */
+    template <typename T>
+    requires std::is_aggregate_v<T>
+    inline constexpr std::size_t FieldCount = Internal::CountFields<T>();
+
+    //! Maximum count of fields supported by Tie
+    inline constexpr std::size_t MaxFields = 16;
+
+    /**
+    * @brief References to the fields of the aggregate
+    * @param value Aggregate
+    * @return Tuple of references to the fields in the order of declaration
+    */
+    template <typename T>
+    requires (std::is_aggregate_v<std::remove_cv_t<T>>
+        && FieldCount<std::remove_cv_t<T>> > 0 && FieldCount<std::remove_cv_t<T>> <= MaxFields)
+    [[nodiscard]] constexpr auto Tie(T& value) noexcept
+    {
+        constexpr auto Count = FieldCount<std::remove_cv_t<T>>;
+
+        if constexpr(Count == 1) {
+            auto& [a] = value;
+            return std::tie(a);
+        } else if constexpr(Count == 2) {
+            auto& [a, b] = value;
+            return std::tie(a, b);
+        } else if constexpr(Count == 3) {
+            auto& [a, b, c] = value;
+            return std::tie(a, b, c);
+        } else if constexpr(Count == 4) {
+            auto& [a, b, c, d] = value;
+            return std::tie(a, b, c, d);
+        } else if constexpr(Count == 5) {
+            auto& [a, b, c, d, e] = value;
+            return std::tie(a, b, c, d, e);
+        } else if constexpr(Count == 6) {
+            auto& [a, b, c, d, e, f] = value;
+            return std::tie(a, b, c, d, e, f);
+        } else if constexpr(Count == 7) {
+            auto& [a, b, c, d, e, f, g] = value;
+            return std::tie(a, b, c, d, e, f, g);
+        } else if constexpr(Count == 8) {
+            auto& [a, b, c, d, e, f, g, h] = value;
+            return std::tie(a, b, c, d, e, f, g, h);
+        } else if constexpr(Count == 9) {
+            auto& [a, b, c, d, e, f, g, h, i] = value;
+            return std::tie(a, b, c, d, e, f, g, h, i);
+        } else if constexpr(Count == 10) {
+            auto& [a, b, c, d, e, f, g, h, i, j] = value;
+            return std::tie(a, b, c, d, e, f, g, h, i, j);
+        } else if constexpr(Count == 11) {
+            auto& [a, b, c, d, e, f, g, h, i, j, k] = value;
+            return std::tie(a, b, c, d, e, f, g, h, i, j, k);
+        } else if constexpr(Count == 12) {
+            auto& [a, b, c, d, e, f, g, h, i, j, k, l] = value;
+            return std::tie(a, b, c, d, e, f, g, h, i, j, k, l);
+        } else if constexpr(Count == 13) {
+            auto& [a, b, c, d, e, f, g, h, i, j, k, l, m] = value;
+            return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m);
+        } else if constexpr(Count == 14) {
+            auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, n] = value;
+            return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, n);
+        } else if constexpr(Count == 15) {
+            auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, n, o] = value;
+            return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o);
+        } else if constexpr(Count == 16) {
+            auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p] = value;
+            return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
+        }
+    }
+
+    //! Tuple of the types of fields of the aggregate
+    template <typename T>
+    using Fields = decltype(Internal::RemoveReferences(Tie(std::declval<T&>())));
+}
+
+#endif // HELENA_TRAITS_FIELDS_HPP
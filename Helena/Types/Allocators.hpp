@@ -2,19 +2,24 @@
 #define HELENA_TYPES_ALLOCATORS_HPP
 
 #include <Helena/Logging/Logging.hpp>
+#include <Helena/Traits/Cacheline.hpp>
 #include <Helena/Traits/NameOf.hpp>
 #include <Helena/Traits/PowerOf2.hpp>
 #include <Helena/Types/FixedBuffer.hpp>
+#include <Helena/Types/Spinlock.hpp>
 #include <Helena/Platform/Assert.hpp>
 #include <Helena/Platform/Platform.hpp>
 #include <Helena/Util/Math.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <bit>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <new>
 #include <utility>
+#include <vector>
 
 namespace Helena::Types
 {
@@ -890,27 +895,27 @@ namespace Helena::Types
     * @tparam AlignmentBucketsGrowthFactor The minimum alignment of memory chunk.
     * @tparam MemoryBucketsGrowthFactor The subsequent bucket sizes of memory.
     * @tparam MemoryBucketsMaxSize The maximum size of memory bucket.
-    * @tparam ChunkBucketsMaxChunks The maximum number of memory chunks per bucket.
-    * @tparam FreeOrphanMemory If true, the memory chunks that are not used are free.
+    * @tparam ChunkBucketsMaxChunks The minimum number of memory chunks per page of bucket.
+    * @tparam FreeOrphanMemory If true, the empty pages beyond the cached ones are freed.
     *
     * @code{.cpp}
-    * Types::MemoryArena<8, 32, 1024, 1024, true> allocator;
+    * Types::ArenaAllocator<8, 32, 1024, 1024, true> allocator;
     * @endcode
     *
     * @note
-    * The architecture of this class is slightly different from the previous ones,
-    * this class takes the type of the allocator class as a template argument,
-    * and then inherits from it, we do not want to take up extra bytes of memory,
-    * and even more so to accept the allocators that we want to track as an upstream memory resource.
-    *
     *   Memory Arena:
     *   Note:   Efficient and fast for allocate, free, clear chunks, but not thread safe!
     *           This arena stores pools and chunks (memory) until clear is called (the destructor also frees memory).
     *           Focused on performance, recommended for use with other allocators where ArenaAllocator
     *           is used as an upstream resource.
+    *           Each bucket is a chain of pages, a page is aligned to its power of two size so the page
+    *           of the chunk is found by the address. Pages with free chunks are linked in the bucket and
+    *           free chunks are linked in the page: allocate and free are O(1) and the bucket grows without limit.
+    *           An empty page is kept for the next allocations, only the empty pages beyond
+    *           EmptyPagesCached are returned to the upstream resource.
     *   Architecture:
-    *   AlignmentsBuckets | MemoryBuckets | ChunkBuckets
-    *           [4]     ->      [32]    ->  [32  byte] [32  byte] [32  byte]
+    *   AlignmentsBuckets | MemoryBuckets | Pages
+    *           [4]     ->      [32]    ->  [32  byte] [32  byte] [32  byte] -> [32  byte] [32  byte] ...
     *                           [64]    ->  [64  byte] [64  byte] [64  byte]
     *                           [96]    ->  [96  byte] [96  byte] [96  byte]
     *                           [128]   ->  [128 byte] [128 byte] [128 byte]
@@ -922,18 +927,6 @@ namespace Helena::Types
     *                           [64]    ->  [64  byte] [64  byte] [64  byte]
     *                           [96]    ->  [96  byte] [96  byte] [96  byte]
     *                           [128]   ->  [128 byte] [128 byte] [128 byte]
-    *           [32]    ->      [32]    ->  [32  byte] [32  byte] [32  byte]
-    *                           [64]    ->  [64  byte] [64  byte] [64  byte]
-    *                           [96]    ->  [96  byte] [96  byte] [96  byte]
-    *                           [128]   ->  [128 byte] [128 byte] [128 byte]
-    *           [64]    ->      [32]    ->  [32  byte] [32  byte] [32  byte]
-    *                           [64]    ->  [64  byte] [64  byte] [64  byte]
-    *                           [96]    ->  [96  byte] [96  byte] [96  byte]
-    *                           [128]   ->  [128 byte] [128 byte] [128 byte]
-    *           [128]   ->      [32]    ->  [32  byte] [32  byte] [32  byte]
-    *                           [64]    ->  [64  byte] [64  byte] [64  byte]
-    *                           [96]    ->  [96  byte] [96  byte] [96  byte]
-    *                           [128]   ->  [128 byte] [128 byte] [128 byte]
     *           ...
     */
     template <
@@ -948,11 +941,14 @@ namespace Helena::Types
     {
         using BitSetType = std::uint64_t;
         static constexpr auto BitSetSize = std::numeric_limits<BitSetType>::digits;
-        static constexpr auto CountChunks = (ChunkBucketsMaxChunks - 1) / BitSetSize + 1;
+        static constexpr auto MaxChunks = ChunkBucketsMaxChunks * 2;
+        static constexpr auto CountChunks = (MaxChunks - 1) / BitSetSize + 1;
+        static constexpr std::size_t EmptyPagesCached = 1;
 
         static_assert(MemoryBucketsGrowthFactor >= 8, "MemoryBucketsGrowthFactor cannot be less than 8");
         static_assert(MemoryBucketsMaxSize >= MemoryBucketsGrowthFactor, "MemoryBucketsMaxSize cannot be less than MemoryBucketsGrowthFactor");
         static_assert(MemoryBucketsMaxSize % MemoryBucketsGrowthFactor == 0, "MemoryBucketsMaxSize must be a multiple of MemoryBucketsGrowthFactor");
+        static_assert(ChunkBucketsMaxChunks > 0, "ChunkBucketsMaxChunks cannot be zero");
 
         template <typename T>
         using ContainerOf = std::vector<T>;
@@ -963,13 +959,36 @@ namespace Helena::Types
         template <typename T>
         using MemoryBuckets = ContainerOf<T>;
 
+        struct FreeChunk {
+            FreeChunk* m_Next;
+        };
+
+        struct Page {
+            // Pages of the bucket with free chunks
+            Page* m_Prev;
+            Page* m_Next;
+
+            // All pages of the bucket
+            Page* m_PrevPage;
+            Page* m_NextPage;
+
+            FreeChunk* m_Free;
+            std::byte* m_Memory;
+            std::size_t m_Stride;
+            std::size_t m_Chunks;
+            std::size_t m_Count;
+            std::size_t m_Carved;
+            BitSetType m_BitSet[CountChunks];
+        };
+
         struct ChunkBuckets {
-            std::size_t m_Count{};
-            BitSetType m_BitSet[CountChunks]{};
-            std::byte* m_Memory{};
+            Page* m_Head{};
+            Page* m_Tail{};
+            Page* m_Pages{};
+            std::size_t m_Empty{};
         };
 
-        using StorageContainers = AlignmentsBuckets<MemoryBuckets<ChunkBuckets*>>;
+        using StorageContainers = AlignmentsBuckets<MemoryBuckets<ChunkBuckets>>;
 
     public:
         explicit ArenaAllocator(IMemoryResource* upstreamResource = DefaultAllocator::Get()) noexcept
@@ -1029,25 +1048,31 @@ namespace Helena::Types
                 Reallocate(memoryBuckets, memoryIndex);
             }
 
-            auto& chunkBucket = memoryBuckets[memoryIndex];
-            if(!chunkBucket) [[unlikely]] {
-                InitChunks(chunkBucket, memoryIndex, alignmentIndex);
+            auto& bucket = memoryBuckets[memoryIndex];
+            if(!bucket.m_Head) [[unlikely]] {
+                InitPage(bucket, memoryIndex, alignmentIndex);
             }
 
-            auto& chunks = *chunkBucket;
-            const auto begin = std::begin(chunks.m_BitSet);
-            const auto end = std::end(chunks.m_BitSet);
-            if(const auto it = std::find_if(begin, end, HasSpaceInBucket); it != end)
-            {
-                const auto distance = std::distance(begin, it);
-                const auto offset = std::countr_one(*it);
-                const auto index = distance * BitSetSize + offset;
-                ++chunks.m_Count;
-                *it |= (1uLL << offset);
-                return chunks.m_Memory + (index * (MemoryBucketsGrowthFactor * (memoryIndex + 1)));
+            const auto page = bucket.m_Head;
+            std::byte* memory{};
+            if(page->m_Free) {
+                memory = reinterpret_cast<std::byte*>(std::exchange(page->m_Free, page->m_Free->m_Next));
+            } else {
+                memory = page->m_Memory + page->m_Carved++ * page->m_Stride;
             }
 
-            return nullptr;
+            if(!page->m_Count++) {
+                --bucket.m_Empty;
+            }
+
+            const auto index = static_cast<std::size_t>(memory - page->m_Memory) / page->m_Stride;
+            page->m_BitSet[index / BitSetSize] |= (1uLL << (index % BitSetSize));
+
+            if(page->m_Count == page->m_Chunks) {
+                Unlink(bucket, page);
+            }
+
+            return memory;
         }
 
         void Free(void* ptr, std::size_t bytes, std::size_t alignment) override
@@ -1074,38 +1099,56 @@ namespace Helena::Types
                 throw std::runtime_error("Memory index out of pool range!");
             }
 
-            auto& chunkBucket = memoryBuckets[memoryIndex];
-            HELENA_ASSERT(chunkBucket, "Memory bucket is nullptr, possible double free!");
-            if(!chunkBucket) [[unlikely]] {
-                throw std::runtime_error("Memory bucket is nullptr, possible double free!");
+            auto& bucket = memoryBuckets[memoryIndex];
+            HELENA_ASSERT(bucket.m_Pages, "Memory bucket is empty, possible double free!");
+            if(!bucket.m_Pages) [[unlikely]] {
+                throw std::runtime_error("Memory bucket is empty, possible double free!");
             }
 
-            auto& chunks = *chunkBucket;
-            const auto blockSize = (memoryIndex + 1) * MemoryBucketsGrowthFactor;
-            HELENA_ASSERT(ptr >= chunks.m_Memory && ptr < (chunks.m_Memory + blockSize * ChunkBucketsMaxChunks - MemoryBucketsGrowthFactor),
+            const auto page = PageOf(ptr, GetSize(memoryIndex, alignmentIndex));
+            const auto memory = static_cast<std::byte*>(ptr);
+            HELENA_ASSERT(memory >= page->m_Memory && memory < page->m_Memory + page->m_Carved * page->m_Stride,
                 "Memory pointer out of range, possible your ptr not allocated using current allocator!");
-            if(chunks.m_Memory > ptr || ptr > (chunks.m_Memory + blockSize * ChunkBucketsMaxChunks - MemoryBucketsGrowthFactor)) [[unlikely]] {
+            if(memory < page->m_Memory || memory >= page->m_Memory + page->m_Carved * page->m_Stride) [[unlikely]] {
                 throw std::runtime_error("Memory pointer out of range, possible your ptr not allocated using current allocator!");
             }
 
-            const auto distance = std::distance(chunks.m_Memory, static_cast<std::byte*>(ptr));
-            const auto index = (distance / (MemoryBucketsGrowthFactor * (memoryIndex + 1)));
+            const auto distance = static_cast<std::size_t>(memory - page->m_Memory);
+            const auto index = distance / page->m_Stride;
             const auto offset = index / BitSetSize;
             const auto bitOffset = index % BitSetSize;
-            HELENA_ASSERT(chunks.m_Memory + blockSize * (offset * BitSetSize + bitOffset) == ptr,
-               "Memory pointer address out of range!");
-            if((chunks.m_Memory + blockSize * (offset * BitSetSize + bitOffset)) != ptr) [[unlikely]] {
+            HELENA_ASSERT(distance % page->m_Stride == 0, "Memory pointer address out of range!");
+            if(distance % page->m_Stride) [[unlikely]] {
                 throw std::runtime_error("Memory pointer address out of range!");
             }
 
-            --chunks.m_Count;
-            chunks.m_BitSet[offset] &= ~(1uLL << bitOffset);
+            HELENA_ASSERT(page->m_BitSet[offset] & (1uLL << bitOffset), "Memory chunk is free, possible double free!");
+            if(!(page->m_BitSet[offset] & (1uLL << bitOffset))) [[unlikely]] {
+                throw std::runtime_error("Memory chunk is free, possible double free!");
+            }
+
+            page->m_BitSet[offset] &= ~(1uLL << bitOffset);
+            page->m_Free = ::new (ptr) FreeChunk{page->m_Free};
+
+            if(page->m_Count-- == page->m_Chunks) {
+                LinkFront(bucket, page);
+            }
 
-            if constexpr(FreeOrphanMemory)
+            if(!page->m_Count)
             {
-                if(!chunks.m_Count) {
-                    Deallocate(chunkBucket, memoryIndex, alignmentIndex);
+                // Pages in use are preferred, the empty page is moved to the end of the chain
+                ++bucket.m_Empty;
+                Unlink(bucket, page);
+
+                if constexpr(FreeOrphanMemory) {
+                    if(bucket.m_Empty > EmptyPagesCached) {
+                        --bucket.m_Empty;
+                        Release(bucket, page, memoryIndex, alignmentIndex);
+                        return;
+                    }
                 }
+
+                LinkBack(bucket, page);
             }
         }
 
@@ -1119,43 +1162,128 @@ namespace Helena::Types
             container.resize(index + 1);
         }
 
-        HELENA_NOINLINE void InitChunks(ChunkBuckets*& storage, std::size_t memoryIndex, std::size_t alignIndex)
+        HELENA_NOINLINE void InitPage(ChunkBuckets& bucket, std::size_t memoryIndex, std::size_t alignIndex)
         {
-            const auto memory = m_UpstreamResource->AllocateMemory(GetSize(memoryIndex), GetAlignment(alignIndex));
+            const auto size = GetSize(memoryIndex, alignIndex);
+            const auto memory = static_cast<std::byte*>(m_UpstreamResource->AllocateMemory(size, size));
             if(!memory) [[unlikely]] {
                 throw std::bad_alloc{};
             }
 
-            const auto headerPlace = static_cast<std::byte*>(memory) + GetHeaderOffset(memoryIndex);
-            storage = new (headerPlace) ChunkBuckets{
+            HELENA_ASSERT(AlignDistance(memory, size) == 0, "Upstream resource did not respect alignment requirement!");
+
+            const auto stride = GetStride(memoryIndex, alignIndex);
+            const auto headerSize = GetHeaderSize(alignIndex);
+            const auto page = ::new (memory) Page{
+                .m_Prev = nullptr,
+                .m_Next = nullptr,
+                .m_PrevPage = nullptr,
+                .m_NextPage = bucket.m_Pages,
+                .m_Free = nullptr,
+                .m_Memory = memory + headerSize,
+                .m_Stride = stride,
+                .m_Chunks = (std::min)((size - headerSize) / stride, MaxChunks),
                 .m_Count = 0,
-                .m_BitSet = {},
-                .m_Memory = static_cast<std::byte*>(memory)
+                .m_Carved = 0,
+                .m_BitSet = {}
             };
+
+            if(bucket.m_Pages) {
+                bucket.m_Pages->m_PrevPage = page;
+            }
+
+            bucket.m_Pages = page;
+            ++bucket.m_Empty;
+            LinkFront(bucket, page);
         }
 
-        void Deallocate(ChunkBuckets*& chunkBucket, std::size_t memoryIndex, std::size_t alignIndex)
+        void Release(ChunkBuckets& bucket, Page* page, std::size_t memoryIndex, std::size_t alignIndex)
         {
-            if(chunkBucket) [[likely]] {
-                m_UpstreamResource->FreeMemory(chunkBucket->m_Memory, GetSize(memoryIndex), GetAlignment(alignIndex));
+            if(page->m_PrevPage) {
+                page->m_PrevPage->m_NextPage = page->m_NextPage;
+            } else {
+                bucket.m_Pages = page->m_NextPage;
             }
-            chunkBucket = nullptr;
+
+            if(page->m_NextPage) {
+                page->m_NextPage->m_PrevPage = page->m_PrevPage;
+            }
+
+            const auto size = GetSize(memoryIndex, alignIndex);
+            m_UpstreamResource->FreeMemory(page, size, size);
         }
 
-        [[nodiscard]] static std::size_t GetHeaderOffset(std::size_t memoryIndex) noexcept {
-            return ChunkBucketsMaxChunks * (MemoryBucketsGrowthFactor * (memoryIndex + 1));
+        void Deallocate(ChunkBuckets& bucket, std::size_t memoryIndex, std::size_t alignIndex)
+        {
+            const auto size = GetSize(memoryIndex, alignIndex);
+            while(bucket.m_Pages) {
+                const auto page = std::exchange(bucket.m_Pages, bucket.m_Pages->m_NextPage);
+                m_UpstreamResource->FreeMemory(page, size, size);
+            }
+
+            bucket = {};
         }
 
-        [[nodiscard]] static std::size_t GetSize(std::size_t memoryIndex) noexcept {
-            return GetHeaderOffset(memoryIndex) + sizeof(ChunkBuckets);
+        static void LinkFront(ChunkBuckets& bucket, Page* page) noexcept
+        {
+            page->m_Prev = nullptr;
+            page->m_Next = std::exchange(bucket.m_Head, page);
+            if(page->m_Next) {
+                page->m_Next->m_Prev = page;
+            } else {
+                bucket.m_Tail = page;
+            }
         }
 
-        [[nodiscard]] static std::size_t GetAlignment(std::size_t alignmentIndex) noexcept {
-            return (std::max)(AlignmentBucketsGrowthFactor * (alignmentIndex + 1), alignof(ChunkBuckets));
+        static void LinkBack(ChunkBuckets& bucket, Page* page) noexcept
+        {
+            page->m_Next = nullptr;
+            page->m_Prev = std::exchange(bucket.m_Tail, page);
+            if(page->m_Prev) {
+                page->m_Prev->m_Next = page;
+            } else {
+                bucket.m_Head = page;
+            }
         }
 
-        [[nodiscard]] static bool HasSpaceInBucket(const BitSetType value) noexcept {
-            return value != (std::numeric_limits<BitSetType>::max)();
+        static void Unlink(ChunkBuckets& bucket, Page* page) noexcept
+        {
+            if(page->m_Prev) {
+                page->m_Prev->m_Next = page->m_Next;
+            } else {
+                bucket.m_Head = page->m_Next;
+            }
+
+            if(page->m_Next) {
+                page->m_Next->m_Prev = page->m_Prev;
+            } else {
+                bucket.m_Tail = page->m_Prev;
+            }
+
+            page->m_Prev = page->m_Next = nullptr;
+        }
+
+        [[nodiscard]] static Page* PageOf(void* ptr, std::size_t size) noexcept {
+            return std::bit_cast<Page*>(std::bit_cast<std::uintptr_t>(ptr) & ~(size - 1));
+        }
+
+        [[nodiscard]] static constexpr std::size_t GetAlignment(std::size_t alignmentIndex) noexcept {
+            return AlignmentBucketsGrowthFactor << alignmentIndex;
+        }
+
+        [[nodiscard]] static constexpr std::size_t GetStride(std::size_t memoryIndex, std::size_t alignmentIndex) noexcept {
+            const auto alignment = GetAlignment(alignmentIndex);
+            return (MemoryBucketsGrowthFactor * (memoryIndex + 1) + alignment - 1) & ~(alignment - 1);
+        }
+
+        [[nodiscard]] static constexpr std::size_t GetHeaderSize(std::size_t alignmentIndex) noexcept {
+            const auto alignment = (std::max)(GetAlignment(alignmentIndex), alignof(Page));
+            return (sizeof(Page) + alignment - 1) & ~(alignment - 1);
+        }
+
+        //! Size and alignment of the page: power of two that fits the header and ChunkBucketsMaxChunks chunks
+        [[nodiscard]] static constexpr std::size_t GetSize(std::size_t memoryIndex, std::size_t alignmentIndex) noexcept {
+            return std::bit_ceil(GetHeaderSize(alignmentIndex) + ChunkBucketsMaxChunks * GetStride(memoryIndex, alignmentIndex));
         }
 
     private:
@@ -1163,6 +1291,619 @@ namespace Helena::Types
         IMemoryResource* m_UpstreamResource;
     };
 
+    /**
+    * @brief CachingAllocator
+    * Thread safe allocator of small blocks with a cache of free blocks per thread.
+    * @tparam SizeClassGrowth The step of size classes and the maximum alignment of blocks.
+    * @tparam MaxSize The maximum size of block, larger blocks are allocated from the upstream resource.
+    * @tparam SlabSize Size of memory requested from the upstream resource, blocks of one size class are carved from the slab.
+    *
+    * @code{.cpp}
+    * Types::CachingAllocator<> allocator;
+    * std::vector<Message, Types::MemoryAllocator<Message>> messages{&allocator};
+    * @endcode
+    *
+    * @note
+    *   Memory Caching:
+    *   Note:   Each thread allocates and frees blocks in its own cache without synchronization.
+    *           A slab belongs to the cache that carved it: a block freed by another thread is pushed
+    *           to the remote queue of the owner and returns to the owner's cache on the next refill.
+    *           When the cache of a size class is empty it's refilled by a batch of blocks from the central
+    *           pool or from the slab, when the cache holds more than two batches one batch is flushed
+    *           to the central pool. The cache of the finished thread is adopted by the next new thread.
+    *           A thread finds its caches of up to 16 allocators without the lookup.
+    *           The upstream resource must be thread safe, slabs are released by the destructor.
+    */
+    template <
+        std::size_t SizeClassGrowth = alignof(std::max_align_t),
+        std::size_t MaxSize = 1024,
+        std::size_t SlabSize = 64 * 1024
+    >
+    requires (Traits::IsPowerOf2<SizeClassGrowth> && Traits::IsPowerOf2<SlabSize>)
+    class CachingAllocator : public IMemoryResource
+    {
+        static constexpr std::size_t ClassCount = MaxSize / SizeClassGrowth;
+        static constexpr std::size_t BatchBytes = 4096;
+        static constexpr std::size_t ThreadSlotCount = 16;
+
+        struct Block {
+            Block* m_Next;
+            Block* m_NextBatch;
+        };
+
+        struct Cache;
+
+        struct Slab {
+            Cache* m_Owner;
+            Slab* m_Next;
+            std::size_t m_Class;
+        };
+
+        static constexpr std::size_t HeaderSize = (sizeof(Slab) + SizeClassGrowth - 1) & ~(SizeClassGrowth - 1);
+
+        static_assert(SizeClassGrowth >= sizeof(Block), "SizeClassGrowth cannot be less than two pointers");
+        static_assert(MaxSize % SizeClassGrowth == 0, "MaxSize must be a multiple of SizeClassGrowth");
+        static_assert(SlabSize >= HeaderSize + MaxSize, "SlabSize cannot be less than MaxSize");
+
+        struct FreeList {
+            Block* m_Head{};
+            std::size_t m_Count{};
+        };
+
+        struct Carve {
+            std::byte* m_Cursor{};
+            std::byte* m_End{};
+        };
+
+        struct alignas(Traits::Cacheline) Cache {
+            // Pushed by other threads, kept apart from the lists of the owner
+            std::atomic<Block*> m_Remote{};
+            alignas(Traits::Cacheline) std::atomic<bool> m_Active{};
+            std::atomic<bool> m_Orphan{};
+            FreeList m_Lists[ClassCount]{};
+            Carve m_Carves[ClassCount]{};
+        };
+
+        struct alignas(Traits::Cacheline) Central {
+            Spinlock m_Lock{};
+            std::atomic<Block*> m_Batches{};
+        };
+
+        //! Cache of the thread for the allocator with the id, the slot is selected by the id
+        struct ThreadSlot {
+            std::uint64_t m_Id;
+            Cache* m_Cache;
+        };
+
+        //! Caches of the thread, the cache is marked inactive when the thread is finished
+        struct ThreadCaches {
+            ~ThreadCaches()
+            {
+                // Blocks freed later on this thread go to the remote queues
+                std::fill_n(ThreadSlots(), ThreadSlotCount, ThreadSlot{});
+                for(const auto& [id, cache] : m_Caches) {
+                    cache->m_Active.store(false, std::memory_order_release);
+                }
+            }
+
+            std::vector<std::pair<std::uint64_t, std::shared_ptr<Cache>>> m_Caches;
+        };
+
+        static inline std::atomic<std::uint64_t> m_Instances{};
+
+    public:
+        explicit CachingAllocator(IMemoryResource* upstreamResource = DefaultAllocator::Get()) noexcept
+            : m_Central{}
+            , m_Caches{}
+            , m_CachesLock{}
+            , m_Slabs{}
+            , m_SlabsLock{}
+            , m_UpstreamResource{upstreamResource}
+            , m_Id{m_Instances.fetch_add(1, std::memory_order_relaxed) + 1} {
+            HELENA_ASSERT(upstreamResource, "Resource is nullptr!");
+        }
+
+        ~CachingAllocator()
+        {
+            for(const auto& cache : m_Caches) {
+                cache->m_Orphan.store(true, std::memory_order_release);
+            }
+
+            while(m_Slabs) {
+                const auto slab = std::exchange(m_Slabs, m_Slabs->m_Next);
+                m_UpstreamResource->FreeMemory(slab, SlabSize, SlabSize);
+            }
+        }
+
+        CachingAllocator(const CachingAllocator&) = delete;
+        CachingAllocator(CachingAllocator&&) noexcept = delete;
+        CachingAllocator& operator=(const CachingAllocator&) = delete;
+        CachingAllocator& operator=(CachingAllocator&&) noexcept = delete;
+
+        [[nodiscard]] IMemoryResource* UpstreamResource() const noexcept {
+            return m_UpstreamResource;
+        }
+
+    protected:
+        void* Allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            if(bytes > MaxSize || alignment > SizeClassGrowth) [[unlikely]] {
+                return m_UpstreamResource->AllocateMemory(bytes, alignment);
+            }
+
+            const auto index = (bytes - 1) / SizeClassGrowth;
+            auto& cache = LocalCache();
+            auto& list = cache.m_Lists[index];
+            if(!list.m_Head) [[unlikely]] {
+                Refill(cache, index);
+            }
+
+            const auto block = list.m_Head;
+            list.m_Head = block->m_Next;
+            --list.m_Count;
+            return block;
+        }
+
+        void Free(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            if(bytes > MaxSize || alignment > SizeClassGrowth) [[unlikely]] {
+                m_UpstreamResource->FreeMemory(ptr, bytes, alignment);
+                return;
+            }
+
+            const auto block = static_cast<Block*>(ptr);
+            const auto owner = SlabOf(block)->m_Owner;
+            if(const auto& slot = LocalSlot(); slot.m_Id != m_Id || slot.m_Cache != owner) [[unlikely]] {
+                // Block of another thread: push to the remote queue of the owner
+                auto head = owner->m_Remote.load(std::memory_order_relaxed);
+                do {
+                    block->m_Next = head;
+                } while(!owner->m_Remote.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+                return;
+            }
+
+            Push(*owner, (bytes - 1) / SizeClassGrowth, block);
+        }
+
+        bool Equal(const IMemoryResource& other) const override {
+            return this == &other;
+        }
+
+    private:
+        [[nodiscard]] static constexpr std::size_t BlockSize(std::size_t index) noexcept {
+            return (index + 1) * SizeClassGrowth;
+        }
+
+        [[nodiscard]] static constexpr std::size_t BatchSize(std::size_t index) noexcept {
+            return std::clamp<std::size_t>(BatchBytes / BlockSize(index), 4, 64);
+        }
+
+        [[nodiscard]] static Slab* SlabOf(void* ptr) noexcept {
+            return std::bit_cast<Slab*>(std::bit_cast<std::uintptr_t>(ptr) & ~(SlabSize - 1));
+        }
+
+        //! Trivially destructible, valid for the frees from the other thread_local destructors
+        [[nodiscard]] static ThreadSlot* ThreadSlots() noexcept {
+            static thread_local ThreadSlot slots[ThreadSlotCount]{};
+            return slots;
+        }
+
+        [[nodiscard]] ThreadSlot& LocalSlot() const noexcept {
+            return ThreadSlots()[m_Id & (ThreadSlotCount - 1)];
+        }
+
+        [[nodiscard]] static ThreadCaches& ThreadCachesList() noexcept {
+            static thread_local ThreadCaches caches{};
+            return caches;
+        }
+
+        [[nodiscard]] Cache& LocalCache()
+        {
+            if(const auto& slot = LocalSlot(); slot.m_Id == m_Id) [[likely]] {
+                return *slot.m_Cache;
+            }
+
+            return Attach();
+        }
+
+        HELENA_NOINLINE Cache& Attach()
+        {
+            auto& caches = ThreadCachesList().m_Caches;
+            std::erase_if(caches, [](const auto& entry) {
+                return entry.second->m_Orphan.load(std::memory_order_acquire);
+            });
+
+            const auto it = std::find_if(caches.cbegin(), caches.cend(), [this](const auto& entry) {
+                return entry.first == m_Id;
+            });
+
+            // The slot was taken by the allocator with the same slot
+            if(it != caches.cend()) {
+                LocalSlot() = {m_Id, it->second.get()};
+                return *it->second;
+            }
+
+            std::shared_ptr<Cache> cache;
+            {
+                // The cache of the finished thread is adopted with its blocks and slabs
+                const std::lock_guard lock{m_CachesLock};
+                for(const auto& candidate : m_Caches) {
+                    if(bool active{}; candidate->m_Active.compare_exchange_strong(active, true, std::memory_order_acquire)) {
+                        cache = candidate;
+                        break;
+                    }
+                }
+
+                if(!cache) {
+                    cache = std::make_shared<Cache>();
+                    cache->m_Active.store(true, std::memory_order_relaxed);
+                    m_Caches.push_back(cache);
+                }
+            }
+
+            caches.emplace_back(m_Id, cache);
+            LocalSlot() = {m_Id, cache.get()};
+            return *cache;
+        }
+
+        void Push(Cache& cache, std::size_t index, Block* block)
+        {
+            auto& list = cache.m_Lists[index];
+            block->m_Next = list.m_Head;
+            list.m_Head = block;
+
+            if(++list.m_Count > 2 * BatchSize(index)) [[unlikely]] {
+                Flush(cache, index);
+            }
+        }
+
+        HELENA_NOINLINE void Refill(Cache& cache, std::size_t index)
+        {
+            // Blocks freed by other threads return first
+            for(auto block = cache.m_Remote.exchange(nullptr, std::memory_order_acquire); block;) {
+                const auto next = block->m_Next;
+                Push(cache, SlabOf(block)->m_Class, block);
+                block = next;
+            }
+
+            auto& list = cache.m_Lists[index];
+            if(list.m_Head) {
+                return;
+            }
+
+            if(auto& central = m_Central[index]; central.m_Batches.load(std::memory_order_relaxed))
+            {
+                const std::lock_guard lock{central.m_Lock};
+                if(const auto batch = central.m_Batches.load(std::memory_order_relaxed)) {
+                    central.m_Batches.store(batch->m_NextBatch, std::memory_order_relaxed);
+                    list.m_Head = batch;
+                    list.m_Count = BatchSize(index);
+                    return;
+                }
+            }
+
+            auto& carve = cache.m_Carves[index];
+            const auto size = BlockSize(index);
+            if(carve.m_Cursor == carve.m_End) {
+                NewSlab(cache, index);
+            }
+
+            for(auto count = BatchSize(index); count && carve.m_Cursor != carve.m_End; --count) {
+                const auto block = ::new (carve.m_Cursor) Block{list.m_Head, nullptr};
+                list.m_Head = block;
+                ++list.m_Count;
+                carve.m_Cursor += size;
+            }
+        }
+
+        void Flush(Cache& cache, std::size_t index)
+        {
+            auto& list = cache.m_Lists[index];
+            const auto batch = list.m_Head;
+            auto last = batch;
+            for(auto count = BatchSize(index); count > 1; --count) {
+                last = last->m_Next;
+            }
+
+            list.m_Head = std::exchange(last->m_Next, nullptr);
+            list.m_Count -= BatchSize(index);
+
+            auto& central = m_Central[index];
+            const std::lock_guard lock{central.m_Lock};
+            batch->m_NextBatch = central.m_Batches.load(std::memory_order_relaxed);
+            central.m_Batches.store(batch, std::memory_order_relaxed);
+        }
+
+        void NewSlab(Cache& cache, std::size_t index)
+        {
+            const auto memory = static_cast<std::byte*>(m_UpstreamResource->AllocateMemory(SlabSize, SlabSize));
+            HELENA_ASSERT(AlignDistance(memory, SlabSize) == 0, "Upstream resource did not respect alignment requirement!");
+
+            const auto slab = ::new (memory) Slab{&cache, nullptr, index};
+            {
+                const std::lock_guard lock{m_SlabsLock};
+                slab->m_Next = std::exchange(m_Slabs, slab);
+            }
+
+            const auto size = BlockSize(index);
+            cache.m_Carves[index] = {
+                .m_Cursor = memory + HeaderSize,
+                .m_End = memory + HeaderSize + (SlabSize - HeaderSize) / size * size
+            };
+        }
+
+    private:
+        Central m_Central[ClassCount];
+        std::vector<std::shared_ptr<Cache>> m_Caches;
+        Spinlock m_CachesLock;
+        Slab* m_Slabs;
+        Spinlock m_SlabsLock;
+        IMemoryResource* m_UpstreamResource;
+        std::uint64_t m_Id;
+    };
+
+    /**
+    * @brief PoolAllocator
+    * Thread safe allocator of fixed size blocks with a lock-free free list.
+    * @tparam BlockSize The size of block.
+    * @tparam BlockAlignment The alignment of block.
+    * @tparam SlabBlocks The count of blocks in the first slab, each next slab is twice larger.
+    *
+    * @code{.cpp}
+    * Types::PoolAllocator<sizeof(Message), alignof(Message)> allocator;
+    * allocator.Reserve(4096);
+    *
+    * Types::MemoryAllocator<Message> messages{&allocator};
+    * const auto message = messages.Allocate(1);
+    * messages.Free(message, 1);
+    * @endcode
+    *
+    * @note
+    *   Memory Pool:
+    *   Note:   Blocks are carved from slabs requested from the upstream resource and are never
+    *           returned to it until the allocator is destroyed, allocate and free only push and pop
+    *           the free list. The head of the free list is the index of block tagged with the counter
+    *           of changes in one 64-bit atomic, so the head that was popped and pushed back between
+    *           the load and the compare is not mistaken for the same head (ABA).
+    *           Only the growth takes the lock, use Reserve to grow before the hot path.
+    *           Blocks larger than BlockSize or with the stricter alignment are allocated from the upstream resource.
+    */
+    template <
+        std::size_t BlockSize,
+        std::size_t BlockAlignment = alignof(std::max_align_t),
+        std::size_t SlabBlocks = 256
+    >
+    requires (BlockSize > 0 && Traits::IsPowerOf2<BlockAlignment> && Traits::IsPowerOf2<SlabBlocks>)
+    class PoolAllocator : public IMemoryResource
+    {
+        using Index = std::uint32_t;
+
+        static constexpr std::size_t Alignment = (std::max)(BlockAlignment, std::atomic_ref<Index>::required_alignment);
+        static constexpr std::size_t Stride = ((std::max)(BlockSize, sizeof(Index)) + Alignment - 1) & ~(Alignment - 1);
+        static constexpr std::size_t MaxSlabs = std::bit_width((std::numeric_limits<Index>::max)() / SlabBlocks + 1) - 1;
+
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "64-bit atomic is not lock-free on this platform");
+        static_assert(MaxSlabs > 0, "SlabBlocks is too large");
+
+    public:
+        explicit PoolAllocator(IMemoryResource* upstreamResource = DefaultAllocator::Get()) noexcept
+            : m_Head{}
+            , m_Used{}
+            , m_Slabs{}
+            , m_SlabCount{}
+            , m_Capacity{}
+            , m_Lock{}
+            , m_UpstreamResource{upstreamResource} {
+            HELENA_ASSERT(upstreamResource, "Resource is nullptr!");
+        }
+
+        ~PoolAllocator()
+        {
+            for(std::size_t slab = 0; slab < m_SlabCount.load(std::memory_order_relaxed); ++slab) {
+                m_UpstreamResource->FreeMemory(m_Slabs[slab], SlabSize(slab), Alignment);
+            }
+        }
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator(PoolAllocator&&) noexcept = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(PoolAllocator&&) noexcept = delete;
+
+        [[nodiscard]] IMemoryResource* UpstreamResource() const noexcept {
+            return m_UpstreamResource;
+        }
+
+        [[nodiscard]] static constexpr std::size_t BlockStride() noexcept {
+            return Stride;
+        }
+
+        //! Count of blocks carved from the slabs
+        [[nodiscard]] std::size_t Capacity() const noexcept {
+            return m_Capacity.load(std::memory_order_relaxed);
+        }
+
+        //! Count of allocated blocks
+        [[nodiscard]] std::size_t Used() const noexcept {
+            return m_Used.load(std::memory_order_relaxed);
+        }
+
+        //! Count of blocks in the free list
+        [[nodiscard]] std::size_t Available() const noexcept {
+            const auto capacity = Capacity();
+            const auto used = Used();
+            return capacity > used ? capacity - used : 0;
+        }
+
+        [[nodiscard]] std::size_t Slabs() const noexcept {
+            return m_SlabCount.load(std::memory_order_relaxed);
+        }
+
+        //! Grow until the capacity is at least count blocks
+        void Reserve(std::size_t count)
+        {
+            const std::lock_guard lock{m_Lock};
+            while(m_Capacity.load(std::memory_order_relaxed) < count) {
+                const auto chain = Grow();
+                Push(chain.m_First, chain.m_Last);
+            }
+        }
+
+    protected:
+        void* Allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            if(bytes > BlockSize || alignment > BlockAlignment) [[unlikely]] {
+                return m_UpstreamResource->AllocateMemory(bytes, alignment);
+            }
+
+            if(const auto block = Pop()) [[likely]] {
+                return block;
+            }
+
+            return Refill();
+        }
+
+        void Free(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            if(bytes > BlockSize || alignment > BlockAlignment) [[unlikely]] {
+                m_UpstreamResource->FreeMemory(ptr, bytes, alignment);
+                return;
+            }
+
+            const auto block = static_cast<std::byte*>(ptr);
+            m_Used.fetch_sub(1, std::memory_order_relaxed);
+            Push(IndexOf(block), block);
+        }
+
+        bool Equal(const IMemoryResource& other) const override {
+            return this == &other;
+        }
+
+    private:
+        //! Blocks of the new slab linked in the order of addresses
+        struct Chain {
+            Index m_First;
+            std::byte* m_Memory;
+            std::byte* m_Last;
+        };
+
+        [[nodiscard]] static constexpr std::size_t SlabBlocksOf(std::size_t slab) noexcept {
+            return SlabBlocks << slab;
+        }
+
+        [[nodiscard]] static constexpr std::size_t SlabSize(std::size_t slab) noexcept {
+            return SlabBlocksOf(slab) * Stride;
+        }
+
+        //! Index of the first block of the slab
+        [[nodiscard]] static constexpr std::size_t SlabFirst(std::size_t slab) noexcept {
+            return SlabBlocks * ((std::size_t{1} << slab) - 1);
+        }
+
+        //! Index of the next free block is stored in the free block
+        [[nodiscard]] static std::atomic_ref<Index> LinkOf(std::byte* block) noexcept {
+            return std::atomic_ref<Index>{*reinterpret_cast<Index*>(block)};
+        }
+
+        //! Head with the index (one based, zero is empty) and the next tag
+        [[nodiscard]] static constexpr std::uint64_t Tagged(std::uint64_t head, Index index) noexcept {
+            return ((head >> 32) + 1) << 32 | index;
+        }
+
+        [[nodiscard]] std::byte* Address(std::size_t index) const noexcept {
+            const auto slab = static_cast<std::size_t>(std::bit_width(index / SlabBlocks + 1) - 1);
+            return m_Slabs[slab] + (index - SlabFirst(slab)) * Stride;
+        }
+
+        [[nodiscard]] Index IndexOf(std::byte* block) const noexcept
+        {
+            // The last slab holds the half of blocks
+            for(auto slab = m_SlabCount.load(std::memory_order_acquire); slab; --slab) {
+                const auto memory = m_Slabs[slab - 1];
+                if(block >= memory && block < memory + SlabSize(slab - 1)) {
+                    HELENA_ASSERT(static_cast<std::size_t>(block - memory) % Stride == 0, "Memory pointer address out of range!");
+                    return static_cast<Index>(SlabFirst(slab - 1) + static_cast<std::size_t>(block - memory) / Stride);
+                }
+            }
+
+            HELENA_ASSERT(false, "Memory pointer out of range, possible your ptr not allocated using current allocator!");
+            return 0;
+        }
+
+        [[nodiscard]] std::byte* Pop() noexcept
+        {
+            auto head = m_Head.load(std::memory_order_acquire);
+            while(static_cast<Index>(head))
+            {
+                // The block can be taken by another thread, then the tag differs and the compare fails
+                const auto block = Address(static_cast<Index>(head) - 1);
+                const auto next = LinkOf(block).load(std::memory_order_relaxed);
+                if(m_Head.compare_exchange_weak(head, Tagged(head, next), std::memory_order_acquire, std::memory_order_acquire)) {
+                    m_Used.fetch_add(1, std::memory_order_relaxed);
+                    return block;
+                }
+            }
+
+            return nullptr;
+        }
+
+        //! Push the linked blocks from the block of index first to the last block
+        void Push(Index first, std::byte* last) noexcept
+        {
+            auto head = m_Head.load(std::memory_order_relaxed);
+            do {
+                LinkOf(last).store(static_cast<Index>(head), std::memory_order_relaxed);
+            } while(!m_Head.compare_exchange_weak(head, Tagged(head, first + 1), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        [[nodiscard]] Chain Grow()
+        {
+            const auto slab = m_SlabCount.load(std::memory_order_relaxed);
+            if(slab >= MaxSlabs) [[unlikely]] {
+                throw std::bad_alloc{};
+            }
+
+            const auto memory = static_cast<std::byte*>(m_UpstreamResource->AllocateMemory(SlabSize(slab), Alignment));
+            const auto first = SlabFirst(slab);
+            const auto count = SlabBlocksOf(slab);
+            for(std::size_t i = 0; i + 1 < count; ++i) {
+                ::new (memory + i * Stride) Index{static_cast<Index>(first + i + 2)};
+            }
+
+            m_Slabs[slab] = memory;
+            m_SlabCount.store(slab + 1, std::memory_order_release);
+            m_Capacity.fetch_add(count, std::memory_order_relaxed);
+            return {static_cast<Index>(first), memory, memory + (count - 1) * Stride};
+        }
+
+        HELENA_NOINLINE void* Refill()
+        {
+            const std::lock_guard lock{m_Lock};
+
+            // Blocks can be freed or another thread has grown the pool while waiting
+            if(const auto block = Pop()) {
+                return block;
+            }
+
+            // The first block is returned, the others are pushed to the free list
+            const auto chain = Grow();
+            if(chain.m_Memory != chain.m_Last) {
+                Push(chain.m_First + 1, chain.m_Last);
+            }
+
+            m_Used.fetch_add(1, std::memory_order_relaxed);
+            return chain.m_Memory;
+        }
+
+    private:
+        alignas(Traits::Cacheline) std::atomic<std::uint64_t> m_Head;
+        alignas(Traits::Cacheline) std::atomic<std::size_t> m_Used;
+        alignas(Traits::Cacheline) std::byte* m_Slabs[MaxSlabs];
+        std::atomic<std::size_t> m_SlabCount;
+        std::atomic<std::size_t> m_Capacity;
+        Spinlock m_Lock;
+        IMemoryResource* m_UpstreamResource;
+    };
+
 
     inline void DefaultAllocator::Set(IMemoryResource* resource) noexcept {
         DefaultAllocator::m_Resource = resource;
@@ -0,0 +1,35 @@
+#ifndef HELENA_TYPES_ENTITY_HPP
+#define HELENA_TYPES_ENTITY_HPP
+
+#include <cstdint>
+#include <limits>
+
+namespace Helena::Types
+{
+    /**
+    * @brief Generational handle of the entity (see: EntityRegistry)
+    * @note The index of the destroyed entity is reused, the version tells the handles
+    * apart: the handle of the destroyed entity is not valid for the new entity.
+    * Default constructed handle is null.
+    */
+    struct Entity
+    {
+        static constexpr std::uint32_t Null = (std::numeric_limits<std::uint32_t>::max)();
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept {
+            return m_Index != Null;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const Entity&) const noexcept = default;
+
+        //! Index and version packed in 64 bits, for example the key of keyed signals
+        [[nodiscard]] constexpr std::uint64_t Id() const noexcept {
+            return (std::uint64_t{m_Version} << 32) | m_Index;
+        }
+
+        std::uint32_t m_Index{Null};
+        std::uint32_t m_Version{};
+    };
+}
+
+#endif // HELENA_TYPES_ENTITY_HPP
@@ -0,0 +1,489 @@
+#ifndef HELENA_TYPES_ENTITYREGISTRY_HPP
+#define HELENA_TYPES_ENTITYREGISTRY_HPP
+
+#include <Helena/Platform/Assert.hpp>
+#include <Helena/Traits/AnyOf.hpp>
+#include <Helena/Traits/Arguments.hpp>
+#include <Helena/Traits/NameOf.hpp>
+#include <Helena/Traits/Remove.hpp>
+#include <Helena/Traits/SameAs.hpp>
+#include <Helena/Types/Allocators.hpp>
+#include <Helena/Types/Entity.hpp>
+#include <Helena/Types/EntitySet.hpp>
+#include <Helena/Types/SoAPool.hpp>
+#include <Helena/Types/UniqueIndexer.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace Helena::Types
+{
+    /**
+    * @brief Components of the type packed in the order of entities of the set
+    * @tparam T Type of component
+    * @note References to components are invalidated when the pool grows or
+    * an entity is erased: the last component is moved in place of the erased one.
+    */
+    template <typename T>
+    requires Traits::SameAs<T, Traits::RemoveCVRP<T>>
+    class ComponentPool final : public EntitySet
+    {
+    public:
+        explicit ComponentPool(IMemoryResource* resource = DefaultAllocator::Get())
+            : EntitySet{resource}
+            , m_Components{MemoryAllocator<T>{resource}} {}
+        ~ComponentPool() override = default;
+        ComponentPool(const ComponentPool&) = delete;
+        ComponentPool(ComponentPool&&) noexcept = delete;
+        ComponentPool& operator=(const ComponentPool&) = delete;
+        ComponentPool& operator=(ComponentPool&&) noexcept = delete;
+
+        template <typename... Args>
+        T& Emplace(Entity entity, Args&&... args)
+        {
+            HELENA_ASSERT(!Contains(entity), "Entity: {} already has the component: {}", entity.m_Index, Traits::NameOf<T>);
+
+            // Clang doesn't support aggregate initialization
+            if constexpr(std::is_aggregate_v<T>) {
+                m_Components.push_back(T{std::forward<Args>(args)...});
+            } else {
+                m_Components.emplace_back(std::forward<Args>(args)...);
+            }
+
+            try {
+                Push(entity);
+            } catch(...) {
+                m_Components.pop_back();
+                throw;
+            }
+
+            return m_Components.back();
+        }
+
+        [[nodiscard]] T& Get(Entity entity) noexcept {
+            return m_Components[Index(entity)];
+        }
+
+        [[nodiscard]] const T& Get(Entity entity) const noexcept {
+            return m_Components[Index(entity)];
+        }
+
+        [[nodiscard]] T* TryGet(Entity entity) noexcept {
+            return Contains(entity) ? &m_Components[Index(entity)] : nullptr;
+        }
+
+        [[nodiscard]] const T* TryGet(Entity entity) const noexcept {
+            return Contains(entity) ? &m_Components[Index(entity)] : nullptr;
+        }
+
+        //! Component at the position of the dense array, the order matches Entities()
+        [[nodiscard]] T& At(std::size_t pos) noexcept {
+            return m_Components[pos];
+        }
+
+        [[nodiscard]] std::span<T> Components() noexcept {
+            return {m_Components.data(), m_Components.size()};
+        }
+
+        [[nodiscard]] std::span<const T> Components() const noexcept {
+            return {m_Components.data(), m_Components.size()};
+        }
+
+        void Erase(Entity entity) override
+        {
+            if(const auto pos = Index(entity); pos + 1u != m_Components.size()) {
+                m_Components[pos] = std::move(m_Components.back());
+            }
+
+            m_Components.pop_back();
+            EntitySet::Erase(entity);
+        }
+
+        void Clear() noexcept override {
+            m_Components.clear();
+            EntitySet::Clear();
+        }
+
+    private:
+        std::vector<T, MemoryAllocator<T>> m_Components;
+    };
+
+    //! Pool of the component type, the tag SoA<T> selects the pool stored by columns
+    template <typename T>
+    struct ComponentStorage {
+        using Type = ComponentPool<T>;
+    };
+
+    template <typename T>
+    struct ComponentStorage<SoA<T>> {
+        using Type = SoAPool<T>;
+    };
+
+    template <typename T>
+    using StorageOf = typename ComponentStorage<T>::Type;
+
+    /**
+    * @brief Entities that have all components of the view
+    * @tparam T Types of components
+    * @note The view iterates over the smallest pool and checks the others,
+    * the view of one component iterates over the packed components.
+    * The component SoA<T> is passed to the callback as the tuple of references to fields.
+    */
+    template <typename... T>
+    requires (sizeof...(T) > 0)
+    class EntityView
+    {
+        template <typename Type>
+        using Reference = decltype(std::declval<StorageOf<Type>&>().At(0));
+
+    public:
+        explicit EntityView(StorageOf<T>&... pools) noexcept
+            : m_Pools{&pools...}
+            , m_Lead{(std::min)({static_cast<EntitySet*>(&pools)...}, [](const auto lhs, const auto rhs) {
+                return lhs->Size() < rhs->Size();
+            })} {}
+        ~EntityView() = default;
+        EntityView(const EntityView&) = default;
+        EntityView(EntityView&&) noexcept = default;
+        EntityView& operator=(const EntityView&) = default;
+        EntityView& operator=(EntityView&&) noexcept = default;
+
+        //! Entities of the smallest pool, the candidates of the iteration
+        [[nodiscard]] std::span<const Entity> Entities() const noexcept {
+            return m_Lead->Entities();
+        }
+
+        //! Upper bound of the count of entities in the view
+        [[nodiscard]] std::size_t SizeHint() const noexcept {
+            return m_Lead->Size();
+        }
+
+        [[nodiscard]] bool Contains(Entity entity) const noexcept {
+            return (Pool<T>()->Contains(entity) && ...);
+        }
+
+        template <typename... Component>
+        requires (Traits::AnyOf<Component, T...> && ...)
+        [[nodiscard]] decltype(auto) Get(Entity entity) const
+        {
+            if constexpr(Traits::Arguments<Component...>::Single) {
+                return Pool<Component...>()->Get(entity);
+            } else {
+                return std::tuple<decltype(Get<Component>(entity))...>{Get<Component>(entity)...};
+            }
+        }
+
+        /**
+        * @brief Call the callback for each entity of the view
+        * @param callback Function with signature: void(Entity, T&...) or void(T&...)
+        * @note The callback can remove components of the current entity or destroy it,
+        * other entities and pools must not be changed during the iteration.
+        */
+        template <typename Callback>
+        requires (std::invocable<Callback&, Entity, Reference<T>...> || std::invocable<Callback&, Reference<T>...>)
+        void Each(Callback&& callback) const {
+            Each(0, SizeHint(), callback);
+        }
+
+        /**
+        * @brief Call the callback for each entity of the view in the range of Entities()
+        * @param first Position of the first candidate
+        * @param last Position after the last candidate
+        * @param callback Function with signature: void(Entity, T&...) or void(T&...)
+        * @note The range is visited from the last position to the first (see: Each)
+        */
+        template <typename Callback>
+        requires (std::invocable<Callback&, Entity, Reference<T>...> || std::invocable<Callback&, Reference<T>...>)
+        void Each(std::size_t first, std::size_t last, Callback&& callback) const
+        {
+            HELENA_ASSERT(first <= last && last <= SizeHint(), "Range: [{}, {}) out of view size: {}", first, last, SizeHint());
+
+            const auto entities = m_Lead->Entities();
+            for(auto pos = last; pos > first; --pos)
+            {
+                const auto entity = entities[pos - 1];
+                if constexpr(sizeof...(T) > 1) {
+                    if(!((static_cast<EntitySet*>(Pool<T>()) == m_Lead
+                        || Pool<T>()->Contains(entity)) && ...)) {
+                        continue;
+                    }
+                }
+
+                if constexpr(std::invocable<Callback&, Entity, Reference<T>...>) {
+                    callback(entity, Component<T>(entity, pos - 1)...);
+                } else {
+                    callback(Component<T>(entity, pos - 1)...);
+                }
+            }
+        }
+
+    private:
+        template <typename Type>
+        [[nodiscard]] StorageOf<Type>* Pool() const noexcept {
+            return std::get<StorageOf<Type>*>(m_Pools);
+        }
+
+        template <typename Type>
+        [[nodiscard]] Reference<Type> Component(Entity entity, std::size_t pos) const noexcept
+        {
+            const auto pool = Pool<Type>();
+            return static_cast<EntitySet*>(pool) == m_Lead ? pool->At(pos) : pool->Get(entity);
+        }
+
+    private:
+        std::tuple<StorageOf<T>*...> m_Pools;
+        EntitySet* m_Lead;
+    };
+
+    //! Hooks of the registry without notifications
+    struct EntityHooks {
+        template <typename T>
+        static void Attach(Entity) noexcept {}
+
+        template <typename T>
+        static void Detach(Entity) noexcept {}
+    };
+
+    /**
+    * @brief Entities with components stored in sparse sets, one pool per component type
+    *
+    * @code{.cpp}
+    * struct Position { float x, y; };
+    * struct Velocity { float x, y; };
+    *
+    * Helena::Types::EntityRegistry<struct MyKey> registry;
+    * const auto entity = registry.Create();
+    * registry.Emplace<Position>(entity, 0.f, 0.f);
+    * registry.Emplace<Velocity>(entity, 1.f, 1.f);
+    *
+    * registry.View<Position, Velocity>().Each([](Position& position, const Velocity& velocity) {
+    *     position.x += velocity.x;
+    *     position.y += velocity.y;
+    * });
+    * @endcode
+    *
+    * @tparam UniqueKey Key of the type indexer of components
+    * @tparam Hooks Type with static functions Attach<T>(Entity), called after the component
+    * is added, and Detach<T>(Entity), called before the component is removed.
+    * The Attach<T> hook must not remove the component or destroy the entity.
+    * @note Pools allocate their memory from the memory resource of the registry (see: SetResource).
+    */
+    template <typename UniqueKey, typename Hooks = EntityHooks>
+    class EntityRegistry
+    {
+    public:
+        explicit EntityRegistry(IMemoryResource* resource = DefaultAllocator::Get())
+            : m_TypeIndexer{}
+            , m_Pools{}
+            , m_Entities{}
+            , m_Free{}
+            , m_Resource{resource} {}
+        ~EntityRegistry() = default;
+        EntityRegistry(const EntityRegistry&) = delete;
+        EntityRegistry(EntityRegistry&&) noexcept = delete;
+        EntityRegistry& operator=(const EntityRegistry&) = delete;
+        EntityRegistry& operator=(EntityRegistry&&) noexcept = delete;
+
+        //! Resolve the indexes of components in bulk (see: UniqueIndexer::Prefill)
+        template <typename... T>
+        void Prefill() const {
+            m_TypeIndexer.template Prefill<T...>();
+        }
+
+        [[nodiscard]] Entity Create()
+        {
+            if(!m_Free.empty()) {
+                const auto index = m_Free.back();
+                m_Free.pop_back();
+                m_Entities[index].m_Index = index;
+                return m_Entities[index];
+            }
+
+            HELENA_ASSERT(m_Entities.size() < Entity::Null, "Entities overflow");
+            return m_Entities.emplace_back(static_cast<std::uint32_t>(m_Entities.size()), 0u);
+        }
+
+        //! Remove the components of the entity and release the index with the next version
+        void Destroy(Entity entity)
+        {
+            HELENA_ASSERT(Valid(entity), "Entity: {} not valid!", entity.m_Index);
+
+            for(auto index = m_Pools.size(); index; --index)
+            {
+                // Hooks can create pools, the vector of pools can be reallocated
+                if(const auto pool = m_Pools[index - 1].get(); pool && pool->Contains(entity)) {
+                    pool->m_Detach(entity);
+                    if(pool->Contains(entity)) {
+                        pool->Erase(entity);
+                    }
+                }
+            }
+
+            m_Entities[entity.m_Index] = {Entity::Null, entity.m_Version + 1u};
+            m_Free.push_back(entity.m_Index);
+        }
+
+        [[nodiscard]] bool Valid(Entity entity) const noexcept {
+            return entity.m_Index < m_Entities.size() && m_Entities[entity.m_Index] == entity;
+        }
+
+        [[nodiscard]] std::size_t Alive() const noexcept {
+            return m_Entities.size() - m_Free.size();
+        }
+
+        template <typename T, typename... Args>
+        requires Traits::SameAs<T, Traits::RemoveCVRP<T>>
+        decltype(auto) Emplace(Entity entity, Args&&... args)
+        {
+            HELENA_ASSERT(Valid(entity), "Entity: {} not valid!", entity.m_Index);
+            auto& pool = Storage<T>();
+            pool.Emplace(entity, std::forward<Args>(args)...);
+            Hooks::template Attach<T>(entity);
+
+            // The attach hook must not remove the component or destroy the entity
+            HELENA_ASSERT(pool.Contains(entity), "Entity: {} lost component: {} in the attach hook", entity.m_Index, Traits::NameOf<T>);
+            return pool.Get(entity);
+        }
+
+        template <typename... T>
+        requires (!Traits::Arguments<T...>::Orphan && (Traits::SameAs<T, Traits::RemoveCVRP<T>> && ...))
+        void Remove(Entity entity)
+        {
+            if constexpr(Traits::Arguments<T...>::Single) {
+                HELENA_ASSERT(Has<T...>(entity), "Entity: {} has no component: {}", entity.m_Index, Traits::NameOf<T...>);
+                Hooks::template Detach<T...>(entity);
+                if(auto& pool = Storage<T...>(); pool.Contains(entity)) {
+                    pool.Erase(entity);
+                }
+            } else (Remove<T>(entity), ...);
+        }
+
+        template <typename... T>
+        requires (!Traits::Arguments<T...>::Orphan && (Traits::SameAs<T, Traits::RemoveCVRP<T>> && ...))
+        [[nodiscard]] bool Has(Entity entity) const
+        {
+            if constexpr(Traits::Arguments<T...>::Single) {
+                const auto pool = Pool<T...>();
+                return pool && pool->Contains(entity);
+            } else {
+                return (Has<T>(entity) && ...);
+            }
+        }
+
+        template <typename... T>
+        requires (Traits::Arguments<T...>::Size > 1 && (Traits::SameAs<T, Traits::RemoveCVRP<T>> && ...))
+        [[nodiscard]] bool Any(Entity entity) const {
+            return (Has<T>(entity) || ...);
+        }
+
+        template <typename... T>
+        requires (!Traits::Arguments<T...>::Orphan && (Traits::SameAs<T, Traits::RemoveCVRP<T>> && ...))
+        [[nodiscard]] decltype(auto) Get(Entity entity)
+        {
+            if constexpr(Traits::Arguments<T...>::Single) {
+                HELENA_ASSERT(Has<T...>(entity), "Entity: {} has no component: {}", entity.m_Index, Traits::NameOf<T...>);
+                return Storage<T...>().Get(entity);
+            } else {
+                return std::tuple<decltype(Get<T>(entity))...>{Get<T>(entity)...};
+            }
+        }
+
+        template <typename T>
+        requires (Traits::SameAs<T, Traits::RemoveCVRP<T>> && Traits::SameAs<StorageOf<T>, ComponentPool<T>>)
+        [[nodiscard]] T* TryGet(Entity entity) {
+            const auto pool = Pool<T>();
+            return pool ? const_cast<ComponentPool<T>*>(pool)->TryGet(entity) : nullptr;
+        }
+
+        template <typename... T>
+        requires (!Traits::Arguments<T...>::Orphan && (Traits::SameAs<T, Traits::RemoveCVRP<T>> && ...))
+        [[nodiscard]] EntityView<T...> View() {
+            return EntityView<T...>{Storage<T>()...};
+        }
+
+        //! Pool of the component, the pool is created on the first access
+        template <typename T>
+        requires Traits::SameAs<T, Traits::RemoveCVRP<T>>
+        [[nodiscard]] StorageOf<T>& Storage()
+        {
+            const auto index = m_TypeIndexer.template Get<T>();
+            if(index >= m_Pools.size()) {
+                m_Pools.resize(index + 1u);
+            }
+
+            if(!m_Pools[index]) {
+                auto pool = std::make_unique<StorageOf<T>>(m_Resource);
+                pool->m_Detach = +[](Entity entity) {
+                    Hooks::template Detach<T>(entity);
+                };
+                m_Pools[index] = std::move(pool);
+            }
+
+            return static_cast<StorageOf<T>&>(*m_Pools[index]);
+        }
+
+        //! Destroy all entities without the notifications, the indexes are released with the next version
+        void Clear()
+        {
+            for(const auto& pool : m_Pools) {
+                if(pool) {
+                    pool->Clear();
+                }
+            }
+
+            // Keep the slots: handles taken before the clear must stay invalid
+            m_Free.clear();
+            m_Free.reserve(m_Entities.size());
+            for(auto index = m_Entities.size(); index; --index) {
+                auto& entity = m_Entities[index - 1];
+                entity = {Entity::Null, entity.m_Version + 1u};
+                m_Free.push_back(static_cast<std::uint32_t>(index - 1));
+            }
+        }
+
+        /**
+        * @brief Set the memory resource of the pools
+        * @param resource Pointer to the memory resource
+        * @note The resource can be changed only before the first pool is created,
+        * the memory of existing pools is owned by the previous resource.
+        */
+        void SetResource(IMemoryResource* resource) noexcept {
+            [[maybe_unused]] const auto pools = std::ranges::count_if(m_Pools, [](const auto& pool) {
+                return static_cast<bool>(pool);
+            });
+
+            HELENA_ASSERT(resource, "Resource is null");
+            HELENA_ASSERT(!pools, "Resource can't be changed after the pools are created");
+            m_Resource = resource;
+        }
+
+        [[nodiscard]] IMemoryResource* GetResource() const noexcept {
+            return m_Resource;
+        }
+
+    private:
+        template <typename T>
+        [[nodiscard]] const StorageOf<T>* Pool() const noexcept
+        {
+            const auto index = m_TypeIndexer.template Get<T>();
+            return index < m_Pools.size() ? static_cast<const StorageOf<T>*>(m_Pools[index].get()) : nullptr;
+        }
+
+    private:
+        UniqueIndexer<UniqueKey> m_TypeIndexer;
+        std::vector<std::unique_ptr<EntitySet>> m_Pools;
+        std::vector<Entity> m_Entities;
+        std::vector<std::uint32_t> m_Free;
+        IMemoryResource* m_Resource;
+    };
+}
+
+#endif // HELENA_TYPES_ENTITYREGISTRY_HPP
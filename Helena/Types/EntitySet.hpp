@@ -0,0 +1,134 @@
+#ifndef HELENA_TYPES_ENTITYSET_HPP
+#define HELENA_TYPES_ENTITYSET_HPP
+
+#include <Helena/Platform/Assert.hpp>
+#include <Helena/Types/Allocators.hpp>
+#include <Helena/Types/Entity.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Helena::Types
+{
+    template <typename, typename>
+    class EntityRegistry;
+
+    /**
+    * @brief Sparse set of entities
+    * @note Entities are packed in the dense array, the sparse array maps the index of
+    * entity to the position in the dense array and is allocated by pages on demand.
+    * Erase moves the last entity in place of the erased one.
+    */
+    class EntitySet
+    {
+        template <typename, typename>
+        friend class EntityRegistry;
+
+        static constexpr std::size_t PageSize = 4096;
+        static constexpr std::uint32_t Tombstone = (std::numeric_limits<std::uint32_t>::max)();
+
+    public:
+        explicit EntitySet(IMemoryResource* resource = DefaultAllocator::Get())
+            : m_Sparse{MemoryAllocator<std::uint32_t*>{resource}}
+            , m_Dense{MemoryAllocator<Entity>{resource}}
+            , m_Resource{resource}
+            , m_Detach{} {}
+
+        virtual ~EntitySet() {
+            for(const auto page : m_Sparse) {
+                m_Resource->FreeMemory(page, PageSize * sizeof(std::uint32_t), alignof(std::uint32_t));
+            }
+        }
+
+        EntitySet(const EntitySet&) = delete;
+        EntitySet(EntitySet&&) noexcept = delete;
+        EntitySet& operator=(const EntitySet&) = delete;
+        EntitySet& operator=(EntitySet&&) noexcept = delete;
+
+        [[nodiscard]] bool Contains(Entity entity) const noexcept {
+            const auto pos = Find(entity.m_Index);
+            return pos != Tombstone && m_Dense[pos] == entity;
+        }
+
+        //! Position of the entity in the dense array
+        [[nodiscard]] std::size_t Index(Entity entity) const noexcept {
+            HELENA_ASSERT(Contains(entity), "Entity: {} not exist!", entity.m_Index);
+            return Find(entity.m_Index);
+        }
+
+        [[nodiscard]] std::size_t Size() const noexcept {
+            return m_Dense.size();
+        }
+
+        [[nodiscard]] bool Empty() const noexcept {
+            return m_Dense.empty();
+        }
+
+        [[nodiscard]] std::span<const Entity> Entities() const noexcept {
+            return {m_Dense.data(), m_Dense.size()};
+        }
+
+        [[nodiscard]] IMemoryResource* MemoryResource() const noexcept {
+            return m_Resource;
+        }
+
+        virtual void Erase(Entity entity)
+        {
+            const auto pos = Index(entity);
+            const auto last = m_Dense.back();
+            m_Dense[pos] = last;
+            Slot(last.m_Index) = static_cast<std::uint32_t>(pos);
+            Slot(entity.m_Index) = Tombstone;
+            m_Dense.pop_back();
+        }
+
+        virtual void Clear() noexcept
+        {
+            for(const auto entity : m_Dense) {
+                Slot(entity.m_Index) = Tombstone;
+            }
+
+            m_Dense.clear();
+        }
+
+    protected:
+        void Push(Entity entity)
+        {
+            const auto page = entity.m_Index / PageSize;
+            if(page >= m_Sparse.size()) {
+                m_Sparse.resize(page + 1u, nullptr);
+            }
+
+            if(!m_Sparse[page]) {
+                const auto memory = static_cast<std::uint32_t*>(m_Resource->AllocateMemory(PageSize * sizeof(std::uint32_t), alignof(std::uint32_t)));
+                std::uninitialized_fill_n(memory, PageSize, Tombstone);
+                m_Sparse[page] = memory;
+            }
+
+            m_Dense.push_back(entity);
+            m_Sparse[page][entity.m_Index % PageSize] = static_cast<std::uint32_t>(m_Dense.size() - 1u);
+        }
+
+    private:
+        [[nodiscard]] std::uint32_t Find(std::uint32_t index) const noexcept {
+            const auto page = index / PageSize;
+            return page < m_Sparse.size() && m_Sparse[page] ? m_Sparse[page][index % PageSize] : Tombstone;
+        }
+
+        [[nodiscard]] std::uint32_t& Slot(std::uint32_t index) noexcept {
+            return m_Sparse[index / PageSize][index % PageSize];
+        }
+
+    private:
+        std::vector<std::uint32_t*, MemoryAllocator<std::uint32_t*>> m_Sparse;
+        std::vector<Entity, MemoryAllocator<Entity>> m_Dense;
+        IMemoryResource* m_Resource;
+        void (*m_Detach)(Entity);
+    };
+}
+
+#endif // HELENA_TYPES_ENTITYSET_HPP
@@ -0,0 +1,169 @@
+#ifndef HELENA_TYPES_HISTOGRAM_HPP
+#define HELENA_TYPES_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Helena::Types
+{
+    /**
+    * @brief Streaming histogram of unsigned values with fixed memory
+    *
+    * @code{.cpp}
+    * Helena::Types::Histogram histogram;
+    * histogram.Add(1500);
+    * histogram.Add(2300);
+    * const auto p99 = histogram.Percentile(99.);
+    * @endcode
+    *
+    * @tparam Precision Count of bits of sub buckets, the relative error is 1 / 2^Precision
+    * @note Buckets are log-linear: values less than 2^Precision have exact buckets,
+    * every next power of two range is split into 2^Precision equal buckets.
+    * Add is O(1) and does not allocate, Percentile is O(Buckets).
+    */
+    template <std::size_t Precision = 3>
+    requires (Precision > 0 && Precision < 16)
+    class Histogram
+    {
+        static constexpr std::size_t SubBuckets = std::size_t{1} << Precision;
+        static constexpr std::size_t Buckets = (std::numeric_limits<std::uint64_t>::digits - Precision + 1) * SubBuckets;
+
+    public:
+        Histogram() noexcept = default;
+        ~Histogram() noexcept = default;
+        Histogram(const Histogram&) noexcept = default;
+        Histogram(Histogram&&) noexcept = default;
+        Histogram& operator=(const Histogram&) noexcept = default;
+        Histogram& operator=(Histogram&&) noexcept = default;
+
+        void Add(std::uint64_t value, std::uint64_t count = 1) noexcept
+        {
+            m_Buckets[Index(value)] += count;
+            m_Count += count;
+            m_Sum += value * count;
+            m_Min = (std::min)(m_Min, value);
+            m_Max = (std::max)(m_Max, value);
+        }
+
+        void Merge(const Histogram& other) noexcept
+        {
+            for(std::size_t i = 0; i < Buckets; ++i) {
+                m_Buckets[i] += other.m_Buckets[i];
+            }
+
+            m_Count += other.m_Count;
+            m_Sum += other.m_Sum;
+            m_Min = (std::min)(m_Min, other.m_Min);
+            m_Max = (std::max)(m_Max, other.m_Max);
+        }
+
+        void Clear() noexcept {
+            *this = Histogram{};
+        }
+
+        [[nodiscard]] std::uint64_t Count() const noexcept {
+            return m_Count;
+        }
+
+        [[nodiscard]] std::uint64_t Sum() const noexcept {
+            return m_Sum;
+        }
+
+        [[nodiscard]] std::uint64_t Min() const noexcept {
+            return m_Count ? m_Min : 0;
+        }
+
+        [[nodiscard]] std::uint64_t Max() const noexcept {
+            return m_Max;
+        }
+
+        [[nodiscard]] double Mean() const noexcept {
+            return m_Count ? static_cast<double>(m_Sum) / static_cast<double>(m_Count) : 0.;
+        }
+
+        /**
+        * @brief Returns the value below which the given percent of values fall
+        * @param percent Percent in range [0, 100]
+        * @return Upper bound of the bucket (clamped to the max value) or 0 if empty
+        */
+        [[nodiscard]] std::uint64_t Percentile(double percent) const noexcept
+        {
+            if(!m_Count) {
+                return 0;
+            }
+
+            const auto clamped = (std::clamp)(percent, 0., 100.);
+            const auto rank = (std::max)(static_cast<std::uint64_t>(clamped / 100. * static_cast<double>(m_Count) + 0.5), std::uint64_t{1});
+
+            std::uint64_t total{};
+            for(std::size_t i = 0; i < Buckets; ++i) {
+                total += m_Buckets[i];
+                if(total >= rank) {
+                    return (std::clamp)(UpperBound(i), Min(), m_Max);
+                }
+            }
+
+            return m_Max;
+        }
+
+        /**
+        * @brief Iterate over the buckets that are not empty
+        * @param callback Function with signature: void(std::uint64_t lower, std::uint64_t upper, std::uint64_t count)
+        */
+        template <typename Callback>
+        requires std::invocable<Callback, std::uint64_t, std::uint64_t, std::uint64_t>
+        void Each(Callback&& callback) const
+        {
+            for(std::size_t i = 0; i < Buckets; ++i) {
+                if(m_Buckets[i]) {
+                    callback(LowerBound(i), UpperBound(i), m_Buckets[i]);
+                }
+            }
+        }
+
+    private:
+        [[nodiscard]] static constexpr std::size_t Index(std::uint64_t value) noexcept
+        {
+            if(value < SubBuckets) {
+                return static_cast<std::size_t>(value);
+            }
+
+            const auto shift = static_cast<std::size_t>(std::bit_width(value)) - 1 - Precision;
+            return (shift + 1) * SubBuckets + static_cast<std::size_t>((value >> shift) - SubBuckets);
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t LowerBound(std::size_t index) noexcept
+        {
+            if(index < SubBuckets) {
+                return index;
+            }
+
+            const auto shift = index / SubBuckets - 1;
+            return (SubBuckets + index % SubBuckets) << shift;
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t UpperBound(std::size_t index) noexcept
+        {
+            if(index < SubBuckets) {
+                return index;
+            }
+
+            const auto shift = index / SubBuckets - 1;
+            return LowerBound(index) + ((std::uint64_t{1} << shift) - 1);
+        }
+
+    private:
+        std::array<std::uint64_t, Buckets> m_Buckets{};
+        std::uint64_t m_Count{};
+        std::uint64_t m_Sum{};
+        std::uint64_t m_Min{(std::numeric_limits<std::uint64_t>::max)()};
+        std::uint64_t m_Max{};
+    };
+}
+
+#endif // HELENA_TYPES_HISTOGRAM_HPP
@@ -0,0 +1,499 @@
+#ifndef HELENA_TYPES_JOBSYSTEM_HPP
+#define HELENA_TYPES_JOBSYSTEM_HPP
+
+#include <Helena/Platform/Assert.hpp>
+#include <Helena/Platform/Defines.hpp>
+#include <Helena/Traits/Cacheline.hpp>
+#include <Helena/Types/Spinlock.hpp>
+#include <Helena/Types/Tracer.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Helena::Types
+{
+    /**
+    * @brief Work-stealing job system
+    *
+    * @code{.cpp}
+    * Helena::Types::JobSystem jobs;
+    * jobs.Start(3);
+    *
+    * const auto root = jobs.Create([]{});
+    * for(std::size_t i = 0; i < 4; ++i) {
+    *     jobs.Run([i]{ Work(i); }, root);
+    * }
+    *
+    * jobs.Schedule(root);
+    * jobs.WaitFor(root);
+    * @endcode
+    *
+    * @note
+    * Each worker owns a Chase-Lev deque: the owner pushes and pops at the bottom,
+    * other threads steal from the top. The thread that called Start becomes worker 0,
+    * threads that are not workers push jobs to a shared deque guarded by a spinlock.
+    * A job is finished when its function and all of its children are finished.
+    * WaitFor executes other jobs while waiting.
+    * Jobs are allocated from a per-worker ring, the slot of a finished job is reused by the next
+    * jobs and the ring grows by JobCapacity jobs when all slots are live. A handle is valid until
+    * the job is finished, don't keep the handles of finished jobs.
+    * Jobs must not throw exceptions.
+    */
+    class JobSystem final
+    {
+        static constexpr std::size_t JobStorage   = 48;
+        static constexpr std::size_t JobCapacity  = 4096;
+        static constexpr std::size_t SpinCount    = 64;
+
+    public:
+        class Job final
+        {
+            friend class JobSystem;
+
+        public:
+            Job() noexcept = default;
+            ~Job() noexcept = default;
+            Job(const Job&) = delete;
+            Job(Job&&) noexcept = delete;
+            Job& operator=(const Job&) = delete;
+            Job& operator=(Job&&) noexcept = delete;
+
+        private:
+            void (*m_Function)(Job&) noexcept {};
+            Job* m_Parent{};
+            std::atomic<std::uint32_t> m_Unfinished{};
+            alignas(std::max_align_t) std::byte m_Storage[JobStorage];
+        };
+
+    private:
+        class Deque final
+        {
+        public:
+            Deque() : m_Top{}, m_Bottom{}, m_Buffer{std::make_unique<std::atomic<Job*>[]>(JobCapacity)} {}
+            ~Deque() = default;
+            Deque(const Deque&) = delete;
+            Deque(Deque&&) noexcept = delete;
+            Deque& operator=(const Deque&) = delete;
+            Deque& operator=(Deque&&) noexcept = delete;
+
+            [[nodiscard]] bool Push(Job* job) noexcept
+            {
+                const auto bottom = m_Bottom.load(std::memory_order_relaxed);
+                const auto top = m_Top.load(std::memory_order_acquire);
+                if(bottom - top >= static_cast<std::int64_t>(JobCapacity)) [[unlikely]] {
+                    return false;
+                }
+
+                m_Buffer[bottom & (JobCapacity - 1)].store(job, std::memory_order_relaxed);
+                m_Bottom.store(bottom + 1, std::memory_order_release);
+                return true;
+            }
+
+            [[nodiscard]] Job* Pop() noexcept
+            {
+                const auto bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+                m_Bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                auto top = m_Top.load(std::memory_order_relaxed);
+
+                if(top > bottom) {
+                    m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                auto job = m_Buffer[bottom & (JobCapacity - 1)].load(std::memory_order_relaxed);
+                if(top == bottom)
+                {
+                    // Last job, race with thieves
+                    if(!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        job = nullptr;
+                    }
+                    m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+
+                return job;
+            }
+
+            [[nodiscard]] Job* Steal() noexcept
+            {
+                auto top = m_Top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const auto bottom = m_Bottom.load(std::memory_order_acquire);
+
+                if(top < bottom)
+                {
+                    const auto job = m_Buffer[top & (JobCapacity - 1)].load(std::memory_order_relaxed);
+                    if(m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        return job;
+                    }
+                }
+
+                return nullptr;
+            }
+
+        private:
+            alignas(Traits::Cacheline) std::atomic<std::int64_t> m_Top;
+            alignas(Traits::Cacheline) std::atomic<std::int64_t> m_Bottom;
+            std::unique_ptr<std::atomic<Job*>[]> m_Buffer;
+        };
+
+        struct alignas(Traits::Cacheline) Worker {
+            Deque m_Queue{};
+            std::vector<std::unique_ptr<Job[]>> m_Jobs{};
+            std::size_t m_Allocated{};
+        };
+
+        struct ThreadInfo {
+            const JobSystem* m_System;
+            std::size_t m_Index;
+        };
+
+        static inline thread_local ThreadInfo m_ThreadInfo{};
+
+    public:
+        JobSystem()
+            : m_Workers{}
+            , m_Threads{}
+            , m_Lock{}
+            , m_Signal{}
+            , m_Pending{}
+            , m_Owner{}
+            , m_Running{}
+            , m_Stop{} {
+            m_Workers.emplace_back(std::make_unique<Worker>());
+        }
+
+        ~JobSystem() {
+            Stop();
+        }
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem(JobSystem&&) noexcept = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem& operator=(JobSystem&&) noexcept = delete;
+
+        /**
+        * @brief Start the worker threads
+        * @param threads Count of worker threads (the calling thread is not included)
+        * @note The calling thread becomes the owner, only the owner can call Stop
+        */
+        void Start(std::size_t threads)
+        {
+            HELENA_ASSERT(!Running(), "JobSystem already started");
+
+            // Workers: [0] owner, [1..threads] threads, [threads + 1] shared for foreign threads
+            m_Workers.clear();
+            for(std::size_t i = 0; i < threads + 2; ++i) {
+                m_Workers.emplace_back(std::make_unique<Worker>());
+            }
+
+            m_Stop.store(false, std::memory_order_relaxed);
+            m_Owner = std::this_thread::get_id();
+            m_ThreadInfo = {this, 0};
+            m_Running.store(true, std::memory_order_release);
+
+            m_Threads.reserve(threads);
+            for(std::size_t i = 1; i <= threads; ++i) {
+                m_Threads.emplace_back([this, i]() {
+                    HELENA_TRACE_THREAD("Job Worker " + std::to_string(i));
+                    m_ThreadInfo = {this, i};
+                    WorkerLoop(i);
+                });
+            }
+        }
+
+        /**
+        * @brief Execute the remaining jobs and join the worker threads
+        */
+        void Stop()
+        {
+            if(!Running()) {
+                return;
+            }
+
+            HELENA_ASSERT(m_Owner == std::this_thread::get_id(), "JobSystem can be stopped only by owner");
+
+            while(m_Pending.load(std::memory_order_acquire)) {
+                if(!ExecuteNext(0)) {
+                    HELENA_PROCESSOR_YIELD();
+                }
+            }
+
+            m_Stop.store(true, std::memory_order_release);
+            m_Signal.fetch_add(1, std::memory_order_release);
+            m_Signal.notify_all();
+
+            for(auto& thread : m_Threads) {
+                thread.join();
+            }
+
+            // Back to a single shared ring: jobs are executed immediately
+            m_Threads.clear();
+            m_Workers.clear();
+            m_Workers.emplace_back(std::make_unique<Worker>());
+            m_Running.store(false, std::memory_order_release);
+
+            if(m_ThreadInfo.m_System == this) {
+                m_ThreadInfo = {};
+            }
+        }
+
+        /**
+        * @brief Check the job system is started
+        * @return True if started, or false
+        */
+        [[nodiscard]] bool Running() const noexcept {
+            return m_Running.load(std::memory_order_acquire);
+        }
+
+        /**
+        * @brief Returns the count of threads executing jobs
+        * @return Count of worker threads including the owner thread
+        */
+        [[nodiscard]] std::size_t Workers() const noexcept {
+            return m_Threads.size() + 1;
+        }
+
+        /**
+        * @brief Create a job without scheduling
+        * @tparam Fn Type of callable
+        * @param fn Callable object, must fit in the job storage
+        * @param parent Parent job, the parent is finished only when all children are finished
+        * @return Job handle
+        * @note Slots of finished jobs are reused, the ring grows when all slots are live
+        */
+        template <typename Fn>
+        requires std::invocable<std::decay_t<Fn>&>
+        [[nodiscard]] Job* Create(Fn&& fn, Job* parent = nullptr)
+        {
+            using Callable = std::decay_t<Fn>;
+            static_assert(sizeof(Callable) <= JobStorage, "Callable is too large for the job storage");
+            static_assert(alignof(Callable) <= alignof(std::max_align_t), "Callable alignment is not supported");
+
+            auto& job = Allocate();
+            ::new (static_cast<void*>(job.m_Storage)) Callable(std::forward<Fn>(fn));
+            job.m_Function = +[](Job& self) noexcept {
+                auto& callable = *std::launder(reinterpret_cast<Callable*>(self.m_Storage));
+                callable();
+                callable.~Callable();
+            };
+            job.m_Parent = parent;
+
+            if(parent) {
+                parent->m_Unfinished.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            return &job;
+        }
+
+        /**
+        * @brief Push the job to the queue of the calling thread
+        * @param job Job handle
+        * @note If the job system is not started or the queue is full, then the job is executed immediately
+        */
+        void Schedule(Job* job)
+        {
+            HELENA_ASSERT(job, "Job is nullptr");
+            m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+            bool pushed{};
+            if(Running())
+            {
+                if(const auto index = CurrentIndex(); index == Shared()) {
+                    const std::lock_guard lock{m_Lock};
+                    pushed = m_Workers[index]->m_Queue.Push(job);
+                } else {
+                    pushed = m_Workers[index]->m_Queue.Push(job);
+                }
+            }
+
+            if(pushed) [[likely]] {
+                m_Signal.fetch_add(1, std::memory_order_release);
+                m_Signal.notify_one();
+            } else {
+                Execute(job);
+            }
+        }
+
+        /**
+        * @brief Create and schedule a job
+        * @tparam Fn Type of callable
+        * @param fn Callable object, must fit in the job storage
+        * @param parent Parent job
+        * @return Job handle
+        */
+        template <typename Fn>
+        requires std::invocable<std::decay_t<Fn>&>
+        Job* Run(Fn&& fn, Job* parent = nullptr) {
+            const auto job = Create(std::forward<Fn>(fn), parent);
+            Schedule(job);
+            return job;
+        }
+
+        /**
+        * @brief Wait for the job and its children, executing other jobs while waiting
+        * @param job Job handle
+        */
+        void WaitFor(const Job* job)
+        {
+            HELENA_ASSERT(job, "Job is nullptr");
+            const auto index = CurrentIndex();
+            std::size_t spins{};
+
+            while(!Finished(job))
+            {
+                if(Running() && ExecuteNext(index)) {
+                    spins = 0;
+                } else if(++spins < SpinCount) {
+                    HELENA_PROCESSOR_YIELD();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        /**
+        * @brief Check the job and its children are finished
+        * @param job Job handle
+        * @return True if finished, or false
+        */
+        [[nodiscard]] static bool Finished(const Job* job) noexcept {
+            return !job->m_Unfinished.load(std::memory_order_acquire);
+        }
+
+    private:
+        [[nodiscard]] std::size_t Shared() const noexcept {
+            return m_Workers.size() - 1;
+        }
+
+        [[nodiscard]] std::size_t CurrentIndex() const noexcept {
+            return m_ThreadInfo.m_System == this ? m_ThreadInfo.m_Index : Shared();
+        }
+
+        [[nodiscard]] Job& Allocate()
+        {
+            // Foreign threads and a not started system share the last ring
+            const auto index = CurrentIndex();
+            auto& worker = *m_Workers[index];
+            std::unique_lock lock{m_Lock, std::defer_lock};
+            if(index == Shared()) {
+                lock.lock();
+            }
+
+            // Skip the slots of live jobs, in the common case the next slot is free
+            const auto capacity = worker.m_Jobs.size() * JobCapacity;
+            for(std::size_t i = 0; i < capacity; ++i) {
+                const auto slot = worker.m_Allocated++ % capacity;
+                auto& job = worker.m_Jobs[slot / JobCapacity][slot & (JobCapacity - 1)];
+                if(Finished(&job)) [[likely]] {
+                    // Marked live under the lock, other threads of the shared ring skip the slot
+                    job.m_Unfinished.store(1, std::memory_order_relaxed);
+                    return job;
+                }
+            }
+
+            // All slots are live: grow the ring, handles of live jobs stay valid
+            worker.m_Allocated = capacity + 1;
+            auto& job = worker.m_Jobs.emplace_back(std::make_unique<Job[]>(JobCapacity))[0];
+            job.m_Unfinished.store(1, std::memory_order_relaxed);
+            return job;
+        }
+
+        [[nodiscard]] Job* Fetch(std::size_t index) noexcept
+        {
+            if(index != Shared()) {
+                if(const auto job = m_Workers[index]->m_Queue.Pop()) {
+                    return job;
+                }
+            }
+
+            // Steal from the other workers, starting from the next one
+            const auto size = m_Workers.size();
+            for(std::size_t i = 1; i <= size; ++i) {
+                const auto victim = (index + i) % size;
+                if(victim != index || index == Shared()) {
+                    if(const auto job = m_Workers[victim]->m_Queue.Steal()) {
+                        return job;
+                    }
+                }
+            }
+
+            return nullptr;
+        }
+
+        bool ExecuteNext(std::size_t index) noexcept
+        {
+            if(const auto job = Fetch(index)) {
+                Execute(job);
+                return true;
+            }
+
+            return false;
+        }
+
+        void Execute(Job* job) noexcept {
+            job->m_Function(*job);
+            Finish(job);
+            m_Pending.fetch_sub(1, std::memory_order_release);
+        }
+
+        static void Finish(Job* job) noexcept
+        {
+            while(job)
+            {
+                const auto parent = job->m_Parent;
+                if(job->m_Unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    break;
+                }
+
+                job = parent;
+            }
+        }
+
+        void WorkerLoop(std::size_t index) noexcept
+        {
+            while(true)
+            {
+                const auto signal = m_Signal.load(std::memory_order_acquire);
+                if(m_Stop.load(std::memory_order_acquire)) {
+                    return;
+                }
+
+                if(ExecuteNext(index)) {
+                    continue;
+                }
+
+                bool executed{};
+                for(std::size_t spin = 0; spin < SpinCount && !executed; ++spin) {
+                    HELENA_PROCESSOR_YIELD();
+                    executed = ExecuteNext(index);
+                }
+
+                if(!executed) {
+                    m_Signal.wait(signal, std::memory_order_acquire);
+                }
+            }
+        }
+
+    private:
+        std::vector<std::unique_ptr<Worker>> m_Workers;
+        std::vector<std::thread> m_Threads;
+        Spinlock m_Lock;
+        alignas(Traits::Cacheline) std::atomic<std::uint32_t> m_Signal;
+        alignas(Traits::Cacheline) std::atomic<std::size_t> m_Pending;
+        std::thread::id m_Owner;
+        std::atomic<bool> m_Running;
+        std::atomic<bool> m_Stop;
+    };
+}
+
+#endif // HELENA_TYPES_JOBSYSTEM_HPP
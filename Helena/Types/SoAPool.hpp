@@ -0,0 +1,224 @@
+#ifndef HELENA_TYPES_SOAPOOL_HPP
+#define HELENA_TYPES_SOAPOOL_HPP
+
+#include <Helena/Platform/Assert.hpp>
+#include <Helena/Traits/Cacheline.hpp>
+#include <Helena/Traits/Fields.hpp>
+#include <Helena/Traits/NameOf.hpp>
+#include <Helena/Types/Allocators.hpp>
+#include <Helena/Types/EntitySet.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Helena::Types
+{
+    //! Tag of the component stored by columns (see: SoAPool, EntityRegistry)
+    template <typename T>
+    struct SoA {};
+
+    /**
+    * @brief Fields of the aggregate component stored in separate columns
+    *
+    * @code{.cpp}
+    * struct Position { float x, y, z; };
+    * struct Velocity { float x, y, z; };
+    *
+    * auto& entities = Helena::Engine::GetEntities();
+    * entities.Emplace<Helena::Types::SoA<Position>>(entity, 0.f, 0.f, 0.f);
+    *
+    * auto& pool = entities.Storage<Helena::Types::SoA<Position>>();
+    * const auto [x, y, z] = pool.Columns();
+    * for(std::size_t i = 0; i < x.size(); ++i) {
+    *     x[i] += 1.f; // contiguous and aligned, the loop can be vectorized
+    * }
+    * @endcode
+    *
+    * @tparam T Aggregate type of component
+    * @note Each column is aligned to the cache line and allocated from the memory resource,
+    * positions in the columns match Entities(). Spans of columns are invalidated when the
+    * pool grows or an entity is erased: the last fields are moved in place of the erased ones.
+    */
+    template <typename T>
+    requires (std::is_aggregate_v<T> && Traits::FieldCount<T> > 0 && Traits::FieldCount<T> <= Traits::MaxFields)
+    class SoAPool final : public EntitySet
+    {
+        using Fields = Traits::Fields<T>;
+        using Sequence = std::make_index_sequence<Traits::FieldCount<T>>;
+        static constexpr std::size_t MinCapacity = 16;
+
+        template <std::size_t Index>
+        using Field = std::tuple_element_t<Index, Fields>;
+
+        template <std::size_t Index>
+        static constexpr std::size_t Alignment = (std::max)(alignof(Field<Index>), Traits::Cacheline);
+
+        static_assert([]<std::size_t... Index>(std::index_sequence<Index...>) {
+            return (std::is_nothrow_move_constructible_v<Field<Index>> && ...);
+        }(Sequence{}), "Fields of component must be nothrow move constructible");
+
+    public:
+        explicit SoAPool(IMemoryResource* resource = DefaultAllocator::Get())
+            : EntitySet{resource}
+            , m_Columns{}
+            , m_Capacity{} {}
+
+        ~SoAPool() override {
+            Clear();
+            Release(m_Columns, m_Capacity);
+        }
+
+        SoAPool(const SoAPool&) = delete;
+        SoAPool(SoAPool&&) noexcept = delete;
+        SoAPool& operator=(const SoAPool&) = delete;
+        SoAPool& operator=(SoAPool&&) noexcept = delete;
+
+        //! Construct the component from args and scatter its fields to the columns
+        template <typename... Args>
+        auto Emplace(Entity entity, Args&&... args)
+        {
+            HELENA_ASSERT(!Contains(entity), "Entity: {} already has the component: {}", entity.m_Index, Traits::NameOf<T>);
+
+            if(Size() == m_Capacity) {
+                Reserve((std::max)(m_Capacity * 2, MinCapacity));
+            }
+
+            T value{std::forward<Args>(args)...};
+            const auto pos = Size();
+
+            [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                const auto fields = Traits::Tie(value);
+                (std::construct_at(Data<Index>() + pos, std::move(std::get<Index>(fields))), ...);
+            }(Sequence{});
+
+            try {
+                Push(entity);
+            } catch(...) {
+                Destroy(pos, pos + 1);
+                throw;
+            }
+
+            return At(pos);
+        }
+
+        //! References to the fields of the component
+        [[nodiscard]] auto Get(Entity entity) noexcept {
+            return At(Index(entity));
+        }
+
+        //! Copy of the component gathered from the columns
+        [[nodiscard]] T Value(Entity entity) const
+        {
+            const auto pos = Index(entity);
+            return [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                return T{Data<Index>()[pos]...};
+            }(Sequence{});
+        }
+
+        //! References to the fields at the position of the dense array, the order matches Entities()
+        [[nodiscard]] auto At(std::size_t pos) noexcept
+        {
+            return [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                return std::tie(Data<Index>()[pos]...);
+            }(Sequence{});
+        }
+
+        template <std::size_t Index>
+        [[nodiscard]] std::span<Field<Index>> Column() noexcept {
+            return {Data<Index>(), Size()};
+        }
+
+        template <std::size_t Index>
+        [[nodiscard]] std::span<const Field<Index>> Column() const noexcept {
+            return {Data<Index>(), Size()};
+        }
+
+        //! Spans of all columns in the order of fields
+        [[nodiscard]] auto Columns() noexcept
+        {
+            return [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                return std::make_tuple(Column<Index>()...);
+            }(Sequence{});
+        }
+
+        [[nodiscard]] std::size_t Capacity() const noexcept {
+            return m_Capacity;
+        }
+
+        void Reserve(std::size_t capacity)
+        {
+            if(capacity <= m_Capacity) {
+                return;
+            }
+
+            std::array<void*, Traits::FieldCount<T>> columns{};
+            [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                try {
+                    ((columns[Index] = MemoryResource()->AllocateMemory(capacity * sizeof(Field<Index>), Alignment<Index>)), ...);
+                } catch(...) {
+                    Release(columns, capacity);
+                    throw;
+                }
+
+                ((std::uninitialized_move_n(Data<Index>(), Size(), static_cast<Field<Index>*>(columns[Index]))), ...);
+            }(Sequence{});
+
+            Destroy(0, Size());
+            Release(m_Columns, m_Capacity);
+            m_Columns = columns;
+            m_Capacity = capacity;
+        }
+
+        void Erase(Entity entity) override
+        {
+            const auto pos = Index(entity);
+            const auto last = Size() - 1;
+
+            [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                if(pos != last) {
+                    ((Data<Index>()[pos] = std::move(Data<Index>()[last])), ...);
+                }
+            }(Sequence{});
+
+            Destroy(last, last + 1);
+            EntitySet::Erase(entity);
+        }
+
+        void Clear() noexcept override {
+            Destroy(0, Size());
+            EntitySet::Clear();
+        }
+
+    private:
+        template <std::size_t Index>
+        [[nodiscard]] Field<Index>* Data() const noexcept {
+            return static_cast<Field<Index>*>(m_Columns[Index]);
+        }
+
+        void Destroy(std::size_t first, std::size_t last) noexcept
+        {
+            [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                (std::destroy(Data<Index>() + first, Data<Index>() + last), ...);
+            }(Sequence{});
+        }
+
+        void Release(const std::array<void*, Traits::FieldCount<T>>& columns, std::size_t capacity) noexcept
+        {
+            [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                ((columns[Index] ? MemoryResource()->FreeMemory(columns[Index], capacity * sizeof(Field<Index>), Alignment<Index>) : void()), ...);
+            }(Sequence{});
+        }
+
+    private:
+        std::array<void*, Traits::FieldCount<T>> m_Columns;
+        std::size_t m_Capacity;
+    };
+}
+
+#endif // HELENA_TYPES_SOAPOOL_HPP
@@ -0,0 +1,406 @@
+#ifndef HELENA_TYPES_TRACER_HPP
+#define HELENA_TYPES_TRACER_HPP
+
+#include <Helena/Platform/Defines.hpp>
+#include <Helena/Util/Process.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Helena::Types
+{
+    /**
+    * @brief Timeline of scoped spans exported in the Chrome trace event format
+    *
+    * @code{.cpp}
+    * void OnUpdate() {
+    *     HELENA_TRACE_SCOPE("Physics", "Game");
+    *     // ...
+    * }
+    *
+    * Helena::Types::Tracer::Export("frames.json"); // open in ui.perfetto.dev or chrome://tracing
+    * @endcode
+    *
+    * @note Each thread records into its own ring buffer without locks, the buffer keeps
+    * the last Capacity spans of the thread. Buffers of finished threads stay for the export
+    * and are reused by the new threads once their spans are exported or cleared. When the
+    * registry holds MaxBuffers, the oldest finished buffer is reused and its spans are lost.
+    * HELENA_TRACE_SCOPE and HELENA_TRACE_THREAD compile to nothing without HELENA_TRACER.
+    */
+    class Tracer final
+    {
+    public:
+        //! Count of spans in the ring buffer of each thread
+        static constexpr std::size_t Capacity = 32 * 1024;
+
+        //! Count of buffers kept before the buffers of finished threads are overwritten
+        static constexpr std::size_t MaxBuffers = 64;
+
+        //! Time in nanoseconds (see: Util::Process::MonotonicTime)
+        struct Span {
+            const char* m_Name;
+            const char* m_Category;
+            std::uint64_t m_Begin;
+            std::uint64_t m_End;
+        };
+
+        //! Record the span from construction to destruction
+        class Scope
+        {
+        public:
+            Scope(const char* name, const char* category) noexcept
+                : m_Name{name}
+                , m_Category{category}
+                , m_Begin{Enabled() ? Util::Process::MonotonicTime() : 0} {}
+            ~Scope() {
+                if(m_Begin) {
+                    Record(m_Name, m_Category, m_Begin, Util::Process::MonotonicTime());
+                }
+            }
+            Scope(const Scope&) = delete;
+            Scope(Scope&&) noexcept = delete;
+            Scope& operator=(const Scope&) = delete;
+            Scope& operator=(Scope&&) noexcept = delete;
+
+        private:
+            const char* m_Name;
+            const char* m_Category;
+            std::uint64_t m_Begin;
+        };
+
+    private:
+        //! Single writer: the owner thread, the head is published after the span is written
+        struct Buffer {
+            explicit Buffer(std::size_t thread)
+                : m_Spans{std::make_unique<Span[]>(Capacity)}
+                , m_Head{}
+                , m_Tail{}
+                , m_Exported{}
+                , m_Finished{}
+                , m_Thread{thread} {}
+
+            std::unique_ptr<Span[]> m_Spans;
+            std::atomic<std::uint64_t> m_Head;
+            std::uint64_t m_Tail;
+            std::uint64_t m_Exported;
+            std::uint64_t m_Finished;   // Order of the finished threads, 0 while the thread is alive
+            std::size_t m_Thread;
+            std::string m_Name;
+        };
+
+        struct Registry {
+            std::mutex m_Mutex;
+            std::vector<std::unique_ptr<Buffer>> m_Buffers;
+            std::size_t m_Threads{};
+            std::uint64_t m_Finished{};
+            std::string m_Output;
+            std::uint64_t m_Epoch{Util::Process::MonotonicTime()};
+            std::atomic<bool> m_Enabled{true};
+        };
+
+        // Threads can record while the statics are destroyed, the registry is never released
+        [[nodiscard]] static Registry& GetRegistry() {
+            static auto* const registry = new Registry{};
+            return *registry;
+        }
+
+        //! Trivially destructible, valid while the other thread_local objects are destroyed
+        struct ThreadState {
+            Buffer* m_Buffer;
+            bool m_Finished;
+        };
+
+        //! Returns the buffer to the registry when the thread is finished
+        struct ThreadOwner {
+            ThreadOwner() {
+                GetThreadState().m_Buffer = Acquire();
+            }
+
+            ~ThreadOwner() {
+                auto& state = GetThreadState();
+                Release(state.m_Buffer);
+                state = {nullptr, true};
+            }
+
+            ThreadOwner(const ThreadOwner&) = delete;
+            ThreadOwner(ThreadOwner&&) noexcept = delete;
+            ThreadOwner& operator=(const ThreadOwner&) = delete;
+            ThreadOwner& operator=(ThreadOwner&&) noexcept = delete;
+        };
+
+        [[nodiscard]] static ThreadState& GetThreadState() noexcept {
+            static thread_local ThreadState state{};
+            return state;
+        }
+
+        //! Returns nullptr when the thread is finished, the spans of the thread_local destructors are skipped
+        [[nodiscard]] static Buffer* ThreadBuffer()
+        {
+            if(const auto& state = GetThreadState(); state.m_Buffer || state.m_Finished) [[likely]] {
+                return state.m_Buffer;
+            }
+
+            return Attach();
+        }
+
+        HELENA_NOINLINE static Buffer* Attach() {
+            static thread_local const ThreadOwner owner{};
+            return GetThreadState().m_Buffer;
+        }
+
+        [[nodiscard]] static Buffer* Acquire()
+        {
+            auto& registry = GetRegistry();
+            const std::lock_guard lock{registry.m_Mutex};
+
+            // Buffer of the finished thread with all spans exported, or the oldest one when the registry is full
+            Buffer* reused{};
+            for(const auto& buffer : registry.m_Buffers)
+            {
+                if(!buffer->m_Finished) {
+                    continue;
+                }
+
+                if((std::max)(buffer->m_Tail, buffer->m_Exported) == buffer->m_Head.load(std::memory_order_relaxed)) {
+                    reused = buffer.get();
+                    break;
+                }
+
+                if(registry.m_Buffers.size() >= MaxBuffers && (!reused || buffer->m_Finished < reused->m_Finished)) {
+                    reused = buffer.get();
+                }
+            }
+
+            const auto thread = ++registry.m_Threads;
+            if(!reused) {
+                return registry.m_Buffers.emplace_back(std::make_unique<Buffer>(thread)).get();
+            }
+
+            reused->m_Tail = reused->m_Head.load(std::memory_order_relaxed);
+            reused->m_Finished = 0;
+            reused->m_Thread = thread;
+            reused->m_Name.clear();
+            return reused;
+        }
+
+        static void Release(Buffer* buffer)
+        {
+            auto& registry = GetRegistry();
+            const std::lock_guard lock{registry.m_Mutex};
+            buffer->m_Finished = ++registry.m_Finished;
+        }
+
+        //! The owner thread can overwrite the span while it is copied, the torn copies are skipped by the export
+        [[nodiscard]] static Span Load(Span& span) noexcept {
+            return {
+                std::atomic_ref{span.m_Name}.load(std::memory_order_relaxed),
+                std::atomic_ref{span.m_Category}.load(std::memory_order_relaxed),
+                std::atomic_ref{span.m_Begin}.load(std::memory_order_relaxed),
+                std::atomic_ref{span.m_End}.load(std::memory_order_relaxed)
+            };
+        }
+
+        static void WriteString(std::FILE* file, const char* str)
+        {
+            for(; str && *str; ++str)
+            {
+                const auto c = static_cast<unsigned char>(*str);
+                if(c == '"' || c == '\\') {
+                    std::fputc('\\', file);
+                    std::fputc(c, file);
+                } else if(c < 0x20) {
+                    std::fprintf(file, "\\u%04x", c);
+                } else {
+                    std::fputc(c, file);
+                }
+            }
+        }
+
+    public:
+        Tracer() = delete;
+        ~Tracer() = delete;
+        Tracer(const Tracer&) = delete;
+        Tracer(Tracer&&) noexcept = delete;
+        Tracer& operator=(const Tracer&) = delete;
+        Tracer& operator=(Tracer&&) noexcept = delete;
+
+        /**
+        * @brief Enable or disable the recording at runtime
+        * @note Enabled by default, a disabled scope costs one relaxed load
+        */
+        static void Enable(bool enable) noexcept {
+            GetRegistry().m_Enabled.store(enable, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static bool Enabled() noexcept {
+            return GetRegistry().m_Enabled.load(std::memory_order_relaxed);
+        }
+
+        //! Name of the current thread in the timeline
+        static void SetThreadName(std::string name)
+        {
+            if(const auto buffer = ThreadBuffer()) {
+                const std::lock_guard lock{GetRegistry().m_Mutex};
+                buffer->m_Name = std::move(name);
+            }
+        }
+
+        /**
+        * @brief Record the span of the current thread
+        * @param name Name of span, the pointer must be valid until the export
+        * @param category Category of span, the pointer must be valid until the export
+        * @param begin Time of begin in nanoseconds
+        * @param end Time of end in nanoseconds
+        */
+        static void Record(const char* name, const char* category, std::uint64_t begin, std::uint64_t end)
+        {
+            const auto buffer = ThreadBuffer();
+            if(!buffer) [[unlikely]] {
+                return;
+            }
+
+            const auto head = buffer->m_Head.load(std::memory_order_relaxed);
+            auto& span = buffer->m_Spans[head % Capacity];
+
+            // Pairs with the acquire fence of Export: the exporter that sees a field
+            // of the overwritten span sees the head of this write
+            std::atomic_thread_fence(std::memory_order_release);
+            std::atomic_ref{span.m_Name}.store(name, std::memory_order_relaxed);
+            std::atomic_ref{span.m_Category}.store(category, std::memory_order_relaxed);
+            std::atomic_ref{span.m_Begin}.store(begin, std::memory_order_relaxed);
+            std::atomic_ref{span.m_End}.store(end, std::memory_order_relaxed);
+            buffer->m_Head.store(head + 1, std::memory_order_release);
+        }
+
+        //! Forget the recorded spans of all threads
+        static void Clear()
+        {
+            auto& registry = GetRegistry();
+            const std::lock_guard lock{registry.m_Mutex};
+            for(const auto& buffer : registry.m_Buffers) {
+                buffer->m_Tail = buffer->m_Head.load(std::memory_order_acquire);
+            }
+        }
+
+        //! File used by Export() without arguments, the engine exports to it on shutdown
+        static void SetOutput(std::string path)
+        {
+            auto& registry = GetRegistry();
+            const std::lock_guard lock{registry.m_Mutex};
+            registry.m_Output = std::move(path);
+        }
+
+        /**
+        * @brief Write the recorded spans to the file as JSON of Chrome trace events
+        * @param path Path of file
+        * @return True if the file is written
+        * @note The format is supported by ui.perfetto.dev and chrome://tracing.
+        * Spans recorded during the export can be skipped.
+        */
+        static bool Export(const std::string& path)
+        {
+            const auto file = std::fopen(path.c_str(), "wb");
+            if(!file) {
+                return false;
+            }
+
+            auto& registry = GetRegistry();
+            const auto time = [epoch = registry.m_Epoch](std::uint64_t ns) {
+                return static_cast<double>(ns > epoch ? ns - epoch : 0) / 1e3;
+            };
+
+            std::vector<Span> spans;
+            std::string name;
+            bool first = true;
+            std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+
+            // The spans are copied under the lock one buffer at a time and written without it,
+            // the new threads are not stalled by the file I/O
+            for(std::size_t index = 0;; ++index)
+            {
+                std::size_t thread{};
+                std::size_t skip{};
+                {
+                    const std::lock_guard lock{registry.m_Mutex};
+                    if(index >= registry.m_Buffers.size()) {
+                        break;
+                    }
+
+                    const auto& buffer = registry.m_Buffers[index];
+                    const auto head = buffer->m_Head.load(std::memory_order_acquire);
+                    const auto begin = (std::max)(buffer->m_Tail, head > Capacity ? head - Capacity : 0);
+
+                    spans.clear();
+                    for(auto position = begin; position < head; ++position) {
+                        spans.push_back(Load(buffer->m_Spans[position % Capacity]));
+                    }
+
+                    // The owner thread could overwrite the oldest spans while they were copied
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    const auto after = buffer->m_Head.load(std::memory_order_relaxed);
+                    const auto valid = after >= Capacity ? after - Capacity + 1 : 0;
+                    skip = static_cast<std::size_t>((std::min)(valid > begin ? valid - begin : 0, head - begin));
+
+                    buffer->m_Exported = head;
+                    thread = buffer->m_Thread;
+                    name = buffer->m_Name;
+                }
+
+                if(!name.empty()) {
+                    std::fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":\"",
+                        first ? "" : ",", thread);
+                    WriteString(file, name.c_str());
+                    std::fputs("\"}}", file);
+                    first = false;
+                }
+
+                for(auto it = spans.cbegin() + static_cast<std::ptrdiff_t>(skip); it != spans.cend(); ++it)
+                {
+                    std::fprintf(file, "%s\n{\"name\":\"", first ? "" : ",");
+                    WriteString(file, it->m_Name);
+                    std::fputs("\",\"cat\":\"", file);
+                    WriteString(file, it->m_Category);
+                    std::fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}",
+                        thread, time(it->m_Begin), time(it->m_End) - time(it->m_Begin));
+                    first = false;
+                }
+            }
+
+            std::fputs("\n]}\n", file);
+            return std::fclose(file) == 0;
+        }
+
+        /**
+        * @brief Write the recorded spans to the output file (see: SetOutput)
+        * @return True if the output is set and the file is written
+        */
+        static bool Export()
+        {
+            std::string output;
+            {
+                auto& registry = GetRegistry();
+                const std::lock_guard lock{registry.m_Mutex};
+                output = registry.m_Output;
+            }
+
+            return !output.empty() && Export(output);
+        }
+    };
+}
+
+#if defined(HELENA_TRACER)
+    #define HELENA_TRACE_SCOPE(name, category)  const ::Helena::Types::Tracer::Scope HELENA_CONCAT(helenaTraceScope, __LINE__){name, category}
+    #define HELENA_TRACE_THREAD(name)           ::Helena::Types::Tracer::SetThreadName(name)
+#else
+    #define HELENA_TRACE_SCOPE(name, category)
+    #define HELENA_TRACE_THREAD(name)
+#endif
+
+#endif // HELENA_TYPES_TRACER_HPP
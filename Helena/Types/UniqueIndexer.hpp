@@ -1,12 +1,17 @@
 #ifndef HELENA_TYPES_UNIQUEINDEXER_HPP
 #define HELENA_TYPES_UNIQUEINDEXER_HPP
 
+#include <Helena/Platform/Assert.hpp>
 #include <Helena/Platform/Defines.hpp>
+#include <Helena/Traits/NameOf.hpp>
 #include <Helena/Types/Hash.hpp>
 
-#include <algorithm>
-#include <vector>
-#include <memory>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
 namespace Helena::Types
 {
@@ -14,10 +19,38 @@ namespace Helena::Types
     class UniqueIndexer
     {
         using Hasher = Hash<std::uint64_t>;
-        using Container = std::vector<typename Hasher::value_type>;
+
+        // Keys are already FNV-1a hashes of the type names
+        struct KeyHash {
+            [[nodiscard]] std::size_t operator()(typename Hasher::value_type key) const noexcept {
+                return static_cast<std::size_t>(key);
+            }
+        };
+
+        // Name is kept to detect the collisions of hashes, it's copied because
+        // the name storage of a plugin is released when the plugin is unloaded
+        struct Entry {
+            std::size_t m_Index;
+            std::string m_Name;
+        };
+
+        using Container = std::unordered_map<typename Hasher::value_type, Entry, KeyHash>;
+
+        // Indexes are cached in statics, so every indexer of the same UniqueKey
+        // (e.g. several contexts in sharded mode) must share one key registry.
+        // Registry lives until the process exits: cached indexes outlive any context.
+        struct Registry {
+            std::mutex m_Mutex;
+            Container m_Keys;
+        };
 
         template <typename T>
-        static inline std::size_t m_TypeIndex{(std::numeric_limits<std::size_t>::max)()};
+        static inline std::atomic<std::size_t> m_TypeIndex{(std::numeric_limits<std::size_t>::max)()};
+
+        [[nodiscard]] static Registry* SharedRegistry() {
+            static auto* const registry = new Registry{};
+            return registry;
+        }
 
     public:
         UniqueIndexer() = default;
@@ -30,35 +63,64 @@ namespace Helena::Types
         template <typename T>
         [[nodiscard]] HELENA_FORCEINLINE std::size_t Get() const noexcept
         {
-            if(m_TypeIndex<T> == (std::numeric_limits<std::size_t>::max)()) [[unlikely]] {
-                TypeIndexer<T>::CacheIndex(m_Indexes);
+            if(const auto index = m_TypeIndex<T>.load(std::memory_order_acquire); index != (std::numeric_limits<std::size_t>::max)()) [[likely]] {
+                return index;
             }
 
-            return m_TypeIndex<T>;
+            return TypeIndexer<T>::CacheIndex(*m_Indexes);
         }
 
-        [[nodiscard]] std::size_t Size() const noexcept {
-            return m_Indexes->size();
+        /**
+        * @brief Resolve the indexes of the types in bulk
+        * @tparam T Types
+        * @note Used by plugins on load: the registry is locked once for all types
+        * instead of once per type on the first access.
+        */
+        template <typename... T>
+        void Prefill() const
+        {
+            const std::lock_guard lock{m_Indexes->m_Mutex};
+            ([this]() {
+                if(m_TypeIndex<T>.load(std::memory_order_acquire) == (std::numeric_limits<std::size_t>::max)()) {
+                    TypeIndexer<T>::Resolve(*m_Indexes);
+                }
+            }(), ...);
+        }
+
+        [[nodiscard]] std::size_t Size() const {
+            const std::lock_guard lock{m_Indexes->m_Mutex};
+            return m_Indexes->m_Keys.size();
         }
 
     private:
         template <typename T>
         struct TypeIndexer
         {
-            HELENA_NOINLINE static void CacheIndex(const std::unique_ptr<Container>& storage) noexcept
+            HELENA_NOINLINE static std::size_t CacheIndex(Registry& registry)
             {
-                if(const auto it = std::find(storage->cbegin(), storage->cend(), m_Key); it != storage->cend()) {
-                    m_TypeIndex<T> = std::distance(storage->cbegin(), it);
-                } else {
-                    storage->emplace_back(m_Key);
-                    m_TypeIndex<T> = storage->size() - 1;
-                }
+                const std::lock_guard lock{registry.m_Mutex};
+                return Resolve(registry);
+            }
+
+            //! Registry must be locked
+            static std::size_t Resolve(Registry& registry)
+            {
+                constexpr std::string_view name{Traits::NameOf<T>};
+                const auto index = registry.m_Keys.size();
+                const auto [it, inserted] = registry.m_Keys.try_emplace(m_Key, Entry{index, std::string{name}});
+                HELENA_ASSERT_RUNTIME(inserted || it->second.m_Name == name,
+                    "Hash collision of types: {} and {}", it->second.m_Name, name);
+
+                m_TypeIndex<T>.store(it->second.m_Index, std::memory_order_release);
+                return it->second.m_Index;
             }
 
             static constexpr auto m_Key = Hasher::template From<T>();
         };
 
-        std::unique_ptr<Container> m_Indexes{std::make_unique<Container>()};
+        // Pointer to the registry of the module that created the indexer: plugins
+        // resolve their own statics through the registry of the owning context.
+        Registry* m_Indexes{SharedRegistry()};
     };
 
 }
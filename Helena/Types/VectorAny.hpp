@@ -15,6 +15,8 @@ namespace Helena::Types
         using Base::Any;
         using Base::Remove;
         using Base::Clear;
+        using Base::EnableArena;
+        using Base::HasArena;
 
     public:
         VectorAny() = default;
@@ -30,6 +32,18 @@ namespace Helena::Types
             Base::template Create<T, T>(std::forward<Args>(args)...);
         }
 
+        template <typename T>
+        requires (Base::template AllowedParam<T>)
+        [[nodiscard]] void* Reserve() {
+            return Base::template Reserve<T, T>();
+        }
+
+        template <typename T>
+        requires (Base::template AllowedParam<T>)
+        void Insert(T* instance) {
+            Base::template Insert<T, T>(instance);
+        }
+
         template <typename... T>
         requires (!Traits::Arguments<T...>::Orphan && (Base::template AllowedParam<T> && ...))
         [[nodiscard]] decltype(auto) Get()
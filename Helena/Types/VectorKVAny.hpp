@@ -3,8 +3,10 @@
 
 #include <Helena/Platform/Defines.hpp>
 #include <Helena/Traits/Arguments.hpp>
+#include <Helena/Traits/Cacheline.hpp>
 #include <Helena/Traits/Constructible.hpp>
 #include <Helena/Traits/NameOf.hpp>
+#include <Helena/Types/Allocators.hpp>
 #include <Helena/Types/UniqueIndexer.hpp>
 
 #include <vector>
@@ -19,6 +21,15 @@ namespace Helena::Types
         using UniqueIndexer = UniqueIndexer<UniqueKey>;
         using UniquePointer = std::unique_ptr<void, void (*)(const void*)>;
 
+        //! Memory of the key in the arena, reused when the key is created again
+        struct Slot {
+            void* m_Memory;
+            std::size_t m_Size;
+            std::size_t m_Alignment;
+        };
+
+        static constexpr std::size_t ArenaChunkSize = 16 * 1024;
+
     public:
         template <typename T>
         static constexpr bool AllowedParam = std::conjunction_v<
@@ -49,20 +60,82 @@ namespace Helena::Types
         {
             const auto index = UniqueIndexer::template Get<Key>();
             if(index >= m_Storage.size()) {
-                ResizeStorage();
+                ResizeStorage(index + 1);
             }
 
             // Clang doesn't support aggregate initialization
+            const auto memory = Reserve<Key, T>();
             T* instance;
             if constexpr(std::is_aggregate_v<T>) {
-                instance = new T{std::forward<Args>(args)...};
+                instance = memory ? ::new (memory) T{std::forward<Args>(args)...} : new T{std::forward<Args>(args)...};
             } else {
-                instance = new T(std::forward<Args>(args)...);
+                instance = memory ? ::new (memory) T(std::forward<Args>(args)...) : new T(std::forward<Args>(args)...);
+            }
+
+            Adopt(index, instance);
+        }
+
+        /**
+        * @brief Place the instances created after the call in the arena of the container
+        * @param chunkSize Size of the first memory chunk of the arena
+        * @note Each instance is aligned to the cache line, the instance of the key keeps
+        * its address when the key is created again after the removal. The memory is released
+        * with the container.
+        */
+        void EnableArena(std::size_t chunkSize = ArenaChunkSize)
+        {
+            if(!m_Arena) {
+                m_Arena = std::make_unique<MonotonicAllocator>(chunkSize);
             }
+        }
 
-            m_Storage[index] = UniquePointer(instance, +[](const void* ptr) {
-                delete static_cast<const T*>(ptr);
-            });
+        [[nodiscard]] bool HasArena() const noexcept {
+            return m_Arena != nullptr;
+        }
+
+        /**
+        * @brief Memory in the arena for the instance of the key
+        * @return Memory for the placement new or nullptr if the arena is disabled
+        * @note The existing instance of the key is not destroyed until the constructed
+        * instance is passed to Insert, the memory is owned by the container.
+        */
+        template <typename Key, typename T>
+        requires (AllowedParam<Key> && AllowedParam<T>)
+        [[nodiscard]] void* Reserve()
+        {
+            if(!m_Arena) {
+                return nullptr;
+            }
+
+            const auto index = UniqueIndexer::template Get<Key>();
+            if(index >= m_Storage.size()) {
+                ResizeStorage(index + 1);
+            }
+
+            // Memory of the alive instance is not reused, it's destroyed after the new one is constructed
+            constexpr auto alignment = (std::max)(alignof(T), Traits::Cacheline);
+            if(auto& slot = m_Slots[index]; !slot.m_Memory || slot.m_Size < sizeof(T) || slot.m_Alignment < alignment
+                || m_Storage[index].get() == slot.m_Memory) {
+                slot = {m_Arena->AllocateMemory(sizeof(T), alignment), sizeof(T), alignment};
+            }
+
+            return m_Slots[index].m_Memory;
+        }
+
+        /**
+        * @brief Take the ownership of the instance created outside of the container
+        * @param instance Instance created by new or in the memory of Reserve
+        */
+        template <typename Key, typename T>
+        requires (AllowedParam<Key> && AllowedParam<T>)
+        void Insert(T* instance)
+        {
+            const auto index = UniqueIndexer::template Get<Key>();
+            if(index >= m_Storage.size()) {
+                ResizeStorage(index + 1);
+            }
+
+            Adopt(index, instance);
         }
 
         template <typename... Key>
@@ -114,11 +187,37 @@ namespace Helena::Types
             }
         }
     private:
-        HELENA_NOINLINE void ResizeStorage() {
-            m_Storage.emplace_back(nullptr, nullptr);
+        HELENA_NOINLINE void ResizeStorage(std::size_t size)
+        {
+            // Indexes are shared by all containers of the UniqueKey, the storage can lag behind
+            m_Storage.reserve(size);
+            while(m_Storage.size() < size) {
+                m_Storage.emplace_back(nullptr, nullptr);
+            }
+
+            m_Slots.resize(size);
+        }
+
+        template <typename T>
+        void Adopt(std::size_t index, T* instance)
+        {
+            // Memory of the arena is released with the container, only destroy the instance.
+            // The previous instance of the key is destroyed after the new one is constructed
+            if(instance == m_Slots[index].m_Memory) {
+                m_Storage[index] = UniquePointer(instance, +[](const void* ptr) {
+                    static_cast<const T*>(ptr)->~T();
+                });
+            } else {
+                m_Storage[index] = UniquePointer(instance, +[](const void* ptr) {
+                    delete static_cast<const T*>(ptr);
+                });
+            }
         }
 
     private:
+        // The arena outlives the instances: members are destroyed in reverse order
+        std::unique_ptr<MonotonicAllocator> m_Arena;
+        std::vector<Slot> m_Slots;
         std::vector<UniquePointer> m_Storage;
     };
 }
@@ -0,0 +1,169 @@
+#ifndef HELENA_TYPES_VECTORPAGED_HPP
+#define HELENA_TYPES_VECTORPAGED_HPP
+
+#include <Helena/Traits/Arguments.hpp>
+#include <Helena/Traits/NameOf.hpp>
+#include <Helena/Traits/Remove.hpp>
+#include <Helena/Traits/SameAs.hpp>
+#include <Helena/Types/UniqueIndexer.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Helena::Types
+{
+    /**
+    * @brief Values indexed by the key type and stored inline in fixed pages
+    * @tparam UniqueKey Key of type indexer
+    * @tparam Type Type of values
+    * @tparam PageSize Count of values in the page
+    * @note Same interface as VectorUnique without the allocation per value: the value
+    * of the key is placed at the slot of its index in the page, so values of neighbouring
+    * keys are adjacent in memory and the addresses are stable. Pages are allocated on
+    * demand and live until the container is destroyed.
+    */
+    template <typename UniqueKey, typename Type, std::size_t PageSize = 64>
+    requires (Traits::SameAs<Type, Traits::RemoveCVRP<Type>> && PageSize > 0)
+    class VectorPaged final
+    {
+        struct Page {
+            alignas(Type) std::byte m_Storage[PageSize * sizeof(Type)];
+        };
+
+    public:
+        VectorPaged() : m_TypeIndexer{}, m_Values{}, m_Pages{} {}
+        ~VectorPaged() {
+            Clear();
+        }
+        VectorPaged(const VectorPaged&) = delete;
+        VectorPaged(VectorPaged&&) noexcept = delete;
+        VectorPaged& operator=(const VectorPaged&) = delete;
+        VectorPaged& operator=(VectorPaged&&) noexcept = delete;
+
+        //! Resolve the indexes of keys in bulk (see: UniqueIndexer::Prefill)
+        template <typename... Key>
+        void Prefill() const {
+            m_TypeIndexer.template Prefill<Key...>();
+        }
+
+        template <typename Key, typename... Args>
+        requires Traits::SameAs<Key, Traits::RemoveCVRP<Key>>
+        void Create(Args&&... args)
+        {
+            const auto index = m_TypeIndexer.template Get<Key>();
+            if(index >= m_Values.size()) {
+                m_Values.resize(index + 1u);
+            }
+
+            HELENA_ASSERT(!m_Values[index], "Key: {} already exist!", Traits::NameOf<Key>);
+
+            const auto page = index / PageSize;
+            if(page >= m_Pages.size()) {
+                m_Pages.resize(page + 1u);
+            }
+
+            if(!m_Pages[page]) {
+                m_Pages[page] = std::make_unique<Page>();
+            }
+
+            const auto memory = m_Pages[page]->m_Storage + index % PageSize * sizeof(Type);
+            m_Values[index] = ::new (memory) Type(std::forward<Args>(args)...);
+        }
+
+        template <typename... Key>
+        requires (!Traits::Arguments<Key...>::Orphan && (Traits::SameAs<Key, Traits::RemoveCVRP<Key>> && ...))
+        [[nodiscard]] bool Has() const
+        {
+            if constexpr(Traits::Arguments<Key...>::Single) {
+                const auto index = m_TypeIndexer.template Get<Key...>();
+                return index < m_Values.size() && m_Values[index];
+            } else {
+                return (Has<Key>() && ...);
+            }
+        }
+
+        template <typename... Key>
+        requires (Traits::Arguments<Key...>::Size > 1 && (Traits::SameAs<Key, Traits::RemoveCVRP<Key>> && ...))
+        [[nodiscard]] bool Any() const {
+            return (Has<Key>() || ...);
+        }
+
+        template <typename... Key>
+        requires (!Traits::Arguments<Key...>::Orphan && (Traits::SameAs<Key, Traits::RemoveCVRP<Key>> && ...))
+        [[nodiscard]] decltype(auto) Get()
+        {
+            if constexpr(Traits::Arguments<Key...>::Single) {
+                const auto index = m_TypeIndexer.template Get<Key...>();
+                HELENA_ASSERT(index < m_Values.size() && m_Values[index], "Key: {} not exist!", Traits::NameOf<Key...>);
+                return *m_Values[index];
+            } else {
+                return std::forward_as_tuple(Get<Key>()...);
+            }
+        }
+
+        template <typename... Key>
+        requires (!Traits::Arguments<Key...>::Orphan && (Traits::SameAs<Key, Traits::RemoveCVRP<Key>> && ...))
+        [[nodiscard]] decltype(auto) Get() const
+        {
+            if constexpr(Traits::Arguments<Key...>::Single) {
+                const auto index = m_TypeIndexer.template Get<Key...>();
+                HELENA_ASSERT(index < m_Values.size() && m_Values[index], "Key: {} not exist!", Traits::NameOf<Key...>);
+                return static_cast<const Type&>(*m_Values[index]);
+            } else {
+                return std::forward_as_tuple(Get<Key>()...);
+            }
+        }
+
+        template <typename Key>
+        requires Traits::SameAs<Key, Traits::RemoveCVRP<Key>>
+        [[nodiscard]] Type* Ptr()
+        {
+            if(const auto index = m_TypeIndexer.template Get<Key>(); index < m_Values.size()) [[likely]] {
+                return m_Values[index];
+            }
+
+            return nullptr;
+        }
+
+        template <typename Key>
+        requires Traits::SameAs<Key, Traits::RemoveCVRP<Key>>
+        [[nodiscard]] const Type* Ptr() const
+        {
+            if(const auto index = m_TypeIndexer.template Get<Key>(); index < m_Values.size()) [[likely]] {
+                return m_Values[index];
+            }
+
+            return nullptr;
+        }
+
+        template <typename... Key>
+        requires (!Traits::Arguments<Key...>::Orphan && (Traits::SameAs<Key, Traits::RemoveCVRP<Key>> && ...))
+        void Remove()
+        {
+            if constexpr(Traits::Arguments<Key...>::Single) {
+                const auto index = m_TypeIndexer.template Get<Key...>();
+                HELENA_ASSERT(index < m_Values.size() && m_Values[index], "Key: {} not exist!", Traits::NameOf<Key...>);
+                std::destroy_at(std::exchange(m_Values[index], nullptr));
+            } else (Remove<Key>(), ...);
+        }
+
+        void Clear() noexcept
+        {
+            for(auto& value : m_Values) {
+                if(value) {
+                    std::destroy_at(std::exchange(value, nullptr));
+                }
+            }
+        }
+
+    private:
+        UniqueIndexer<UniqueKey> m_TypeIndexer;
+        std::vector<Type*> m_Values;
+        std::vector<std::unique_ptr<Page>> m_Pages;
+    };
+}
+
+#endif // HELENA_TYPES_VECTORPAGED_HPP
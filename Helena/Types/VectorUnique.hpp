@@ -8,6 +8,7 @@
 #include <Helena/Types/UniqueIndexer.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace Helena::Types
 {
@@ -23,6 +24,12 @@ namespace Helena::Types
         VectorUnique& operator=(const VectorUnique&) = delete;
         VectorUnique& operator=(VectorUnique&&) noexcept = delete;
 
+        //! Resolve the indexes of keys in bulk (see: UniqueIndexer::Prefill)
+        template <typename... Key>
+        void Prefill() const {
+            m_TypeIndexer.template Prefill<Key...>();
+        }
+
         template <typename Key, typename... Args>
         requires Traits::SameAs<Key, Traits::RemoveCVRP<Key>>
         void Create(Args&&... args)
@@ -52,6 +52,73 @@ namespace Helena::Util
             std::this_thread::sleep_for(time);
         }
 
+        /**
+        * @brief Returns the time of the monotonic clock
+        * @return Time in nanoseconds (CLOCK_MONOTONIC on Linux, QueryPerformanceCounter on Windows)
+        */
+        [[nodiscard]] static std::uint64_t MonotonicTime() noexcept
+        {
+        #if defined(HELENA_PLATFORM_WIN)
+            static LARGE_INTEGER frequency{};
+            static const auto queryFrequency = ::QueryPerformanceFrequency(&frequency);
+            LARGE_INTEGER now;
+            if(!queryFrequency || !::QueryPerformanceCounter(&now)) [[unlikely]] {
+                return ::GetTickCount64() * 1'000'000ULL;
+            }
+
+            // Split to avoid overflow of counter * 10^9
+            const auto counter = static_cast<std::uint64_t>(now.QuadPart);
+            const auto freq = static_cast<std::uint64_t>(frequency.QuadPart);
+            return (counter / freq) * 1'000'000'000ULL + (counter % freq) * 1'000'000'000ULL / freq;
+        #elif defined(HELENA_PLATFORM_LINUX)
+            struct timespec ts;
+            ::clock_gettime(CLOCK_MONOTONIC, &ts);
+            return static_cast<std::uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<std::uint64_t>(ts.tv_nsec);
+        #else
+            #error Unsupported platform
+        #endif
+        }
+
+        /**
+        * @brief Sleep until the absolute deadline of the monotonic clock
+        * @param deadline Time in nanoseconds (see: MonotonicTime)
+        * @note Linux uses clock_nanosleep with TIMER_ABSTIME, Windows uses a high resolution waitable timer
+        */
+        static void SleepUntil(const std::uint64_t deadline)
+        {
+        #if defined(HELENA_PLATFORM_WIN)
+            const auto now = MonotonicTime();
+            if(deadline <= now) {
+                return;
+            }
+
+            static thread_local const auto timer = []() {
+            #if defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+                if(const auto handle = ::CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS)) {
+                    return handle;
+                }
+            #endif
+                return ::CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+            }();
+
+            // Relative due time in 100 ns units
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -static_cast<LONGLONG>((deadline - now) / 100);
+            if(timer && ::SetWaitableTimer(timer, &dueTime, 0, nullptr, nullptr, FALSE)) {
+                (void)::WaitForSingleObject(timer, INFINITE);
+            } else {
+                ::Sleep(static_cast<DWORD>((deadline - now) / 1'000'000));
+            }
+        #elif defined(HELENA_PLATFORM_LINUX)
+            struct timespec ts;
+            ts.tv_sec = static_cast<time_t>(deadline / 1'000'000'000ULL);
+            ts.tv_nsec = static_cast<long>(deadline % 1'000'000'000ULL);
+            while(::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {}
+        #else
+            #error Unsupported platform
+        #endif
+        }
+
         HELENA_NOINLINE
         static auto Stacktrace(std::size_t maxFrames = 64)
         {
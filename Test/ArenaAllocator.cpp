@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <Helena/Types/Allocators.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+using Helena::Types::ArenaAllocator;
+using Helena::Types::DefaultAllocator;
+using Helena::Types::IMemoryResource;
+
+namespace {
+    class CountingResource final : public IMemoryResource
+    {
+    public:
+        std::size_t m_Allocations{};
+        std::size_t m_Frees{};
+
+    protected:
+        void* Allocate(std::size_t bytes, std::size_t alignment) override {
+            ++m_Allocations;
+            return DefaultAllocator::Get()->AllocateMemory(bytes, alignment);
+        }
+
+        void Free(void* ptr, std::size_t bytes, std::size_t alignment) override {
+            ++m_Frees;
+            DefaultAllocator::Get()->FreeMemory(ptr, bytes, alignment);
+        }
+
+        bool Equal(const IMemoryResource& other) const override {
+            return this == &other;
+        }
+    };
+}
+
+TEST(ArenaAllocator, GrowsPastMaxChunks)
+{
+    CountingResource upstream;
+    {
+        // Pages of 8 chunks at least, the bucket grows by pages
+        ArenaAllocator<16, 32, 1024, 8> allocator{&upstream};
+
+        std::vector<std::byte*> chunks;
+        for(std::size_t i = 0; i < 200; ++i) {
+            chunks.push_back(static_cast<std::byte*>(allocator.AllocateMemory(32, 16)));
+            std::memset(chunks.back(), static_cast<int>(i & 0xFF), 32);
+        }
+
+        EXPECT_GT(upstream.m_Allocations, 1u);
+        EXPECT_EQ(std::set(chunks.cbegin(), chunks.cend()).size(), chunks.size());
+
+        for(std::size_t i = 0; i < chunks.size(); ++i) {
+            EXPECT_EQ(chunks[i][0], static_cast<std::byte>(i & 0xFF));
+            EXPECT_EQ(chunks[i][31], static_cast<std::byte>(i & 0xFF));
+            allocator.FreeMemory(chunks[i], 32, 16);
+        }
+
+        // Only one empty page is cached, the others are returned to the upstream
+        EXPECT_EQ(upstream.m_Frees, upstream.m_Allocations - 1);
+    }
+
+    EXPECT_EQ(upstream.m_Frees, upstream.m_Allocations);
+}
+
+TEST(ArenaAllocator, NoUpstreamChurnAtPageBoundary)
+{
+    CountingResource upstream;
+    ArenaAllocator<16, 32, 1024, 8> allocator{&upstream};
+
+    // Fill the first page and take the first chunk of the second one
+    std::vector<void*> chunks;
+    while(upstream.m_Allocations < 2) {
+        chunks.push_back(allocator.AllocateMemory(64, 16));
+    }
+
+    // The second page becomes empty on each free, it's kept for the next allocation
+    for(int i = 0; i < 1000; ++i) {
+        allocator.FreeMemory(chunks.back(), 64, 16);
+        chunks.back() = allocator.AllocateMemory(64, 16);
+    }
+
+    // The same boundary from the other side: the first page is full again on each allocation
+    for(int i = 0; i < 1000; ++i) {
+        allocator.FreeMemory(chunks.front(), 64, 16);
+        chunks.front() = allocator.AllocateMemory(64, 16);
+    }
+
+    EXPECT_EQ(upstream.m_Allocations, 2u);
+    EXPECT_EQ(upstream.m_Frees, 0u);
+
+    for(const auto chunk : chunks) {
+        allocator.FreeMemory(chunk, 64, 16);
+    }
+}
+
+TEST(ArenaAllocator, OverAlignedBuckets)
+{
+    ArenaAllocator<16, 32, 1024, 16> allocator;
+
+    for(std::size_t alignment = 32; alignment <= 512; alignment *= 2)
+    {
+        for(std::size_t size = 1; size <= 1024; size += 93)
+        {
+            std::vector<void*> chunks;
+            for(int i = 0; i < 40; ++i)
+            {
+                const auto chunk = allocator.AllocateMemory(size, alignment);
+                EXPECT_EQ(reinterpret_cast<std::uintptr_t>(chunk) % alignment, 0u)
+                    << "size: " << size << " alignment: " << alignment;
+                std::memset(chunk, 0xCD, size);
+                chunks.push_back(chunk);
+            }
+
+            for(const auto chunk : chunks) {
+                allocator.FreeMemory(chunk, size, alignment);
+            }
+        }
+    }
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <Helena/Types/Allocators.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using Helena::Types::CachingAllocator;
+using Helena::Types::DefaultAllocator;
+using Helena::Types::IMemoryResource;
+
+namespace {
+    class CountingResource final : public IMemoryResource
+    {
+    public:
+        [[nodiscard]] std::size_t Allocations() const noexcept {
+            return m_Allocations.load();
+        }
+
+    protected:
+        void* Allocate(std::size_t bytes, std::size_t alignment) override {
+            ++m_Allocations;
+            return DefaultAllocator::Get()->AllocateMemory(bytes, alignment);
+        }
+
+        void Free(void* ptr, std::size_t bytes, std::size_t alignment) override {
+            DefaultAllocator::Get()->FreeMemory(ptr, bytes, alignment);
+        }
+
+        bool Equal(const IMemoryResource& other) const override {
+            return this == &other;
+        }
+
+    private:
+        std::atomic<std::size_t> m_Allocations{};
+    };
+
+    constexpr std::size_t BlockSize = 64;
+
+    std::vector<std::uint64_t*> AllocateBlocks(IMemoryResource& allocator, std::size_t count, std::uint64_t tag)
+    {
+        std::vector<std::uint64_t*> blocks;
+        for(std::size_t i = 0; i < count; ++i) {
+            blocks.push_back(static_cast<std::uint64_t*>(allocator.AllocateMemory(BlockSize)));
+            *blocks.back() = tag + i;
+        }
+
+        return blocks;
+    }
+
+    bool FreeBlocks(IMemoryResource& allocator, const std::vector<std::uint64_t*>& blocks, std::uint64_t tag)
+    {
+        bool intact = true;
+        for(std::size_t i = 0; i < blocks.size(); ++i) {
+            intact &= *blocks[i] == tag + i;
+            allocator.FreeMemory(blocks[i], BlockSize);
+        }
+
+        return intact;
+    }
+}
+
+TEST(CachingAllocator, FreesOnAnotherThread)
+{
+    CountingResource upstream;
+    CachingAllocator<> allocator{&upstream};
+
+    std::size_t slabs{};
+    for(int round = 0; round < 10; ++round)
+    {
+        const auto blocks = AllocateBlocks(allocator, 1000, 0);
+        EXPECT_EQ(std::set(blocks.cbegin(), blocks.cend()).size(), blocks.size());
+
+        bool intact{};
+        std::thread{[&] { intact = FreeBlocks(allocator, blocks, 0); }}.join();
+        EXPECT_TRUE(intact);
+
+        // The blocks return to the owner through the remote queue, no new slabs after the first round
+        if(!round) {
+            slabs = upstream.Allocations();
+        }
+
+        EXPECT_EQ(upstream.Allocations(), slabs);
+    }
+}
+
+TEST(CachingAllocator, TwoAllocatorsOnOneThread)
+{
+    // The first and the last allocator share the slot of the thread cache
+    CountingResource upstream[17];
+    std::vector<std::unique_ptr<CachingAllocator<>>> allocators;
+    for(auto& resource : upstream) {
+        allocators.push_back(std::make_unique<CachingAllocator<>>(&resource));
+    }
+
+    auto& first = *allocators.front();
+    auto& second = *allocators.back();
+    auto& neighbour = *allocators[1];
+
+    for(int round = 0; round < 4; ++round)
+    {
+        const auto a = AllocateBlocks(first, 500, 1000);
+        const auto b = AllocateBlocks(second, 500, 2000);
+        const auto c = AllocateBlocks(neighbour, 500, 3000);
+
+        EXPECT_TRUE(FreeBlocks(second, b, 2000));
+        EXPECT_TRUE(FreeBlocks(first, a, 1000));
+        EXPECT_TRUE(FreeBlocks(neighbour, c, 3000));
+    }
+
+    // Each allocator got its slabs from its upstream and reused them in the next rounds
+    EXPECT_EQ(upstream[0].Allocations(), 1u);
+    EXPECT_EQ(upstream[16].Allocations(), 1u);
+    EXPECT_EQ(upstream[1].Allocations(), 1u);
+
+    // The blocks of the destroyed allocator are not handed out by the other one
+    allocators.back().reset();
+    const auto blocks = AllocateBlocks(first, 1000, 4000);
+    EXPECT_TRUE(FreeBlocks(first, blocks, 4000));
+}
+
+TEST(CachingAllocator, CacheAdoptedAfterThreadExit)
+{
+    CountingResource upstream;
+    CachingAllocator<> allocator{&upstream};
+
+    std::vector<std::uint64_t*> blocks;
+    std::thread{[&]
+    {
+        blocks = AllocateBlocks(allocator, 1000, 0);
+        const std::vector half(blocks.cbegin(), blocks.cbegin() + 500);
+        EXPECT_TRUE(FreeBlocks(allocator, half, 0));
+        blocks.erase(blocks.cbegin(), blocks.cbegin() + 500);
+    }}.join();
+
+    // The rest is freed after the owner has finished and goes to the remote queue of its cache
+    EXPECT_TRUE(FreeBlocks(allocator, blocks, 500));
+    const auto slabs = upstream.Allocations();
+
+    // The next thread adopts the cache with its slabs and blocks
+    std::thread{[&]
+    {
+        const auto adopted = AllocateBlocks(allocator, 1000, 5000);
+        EXPECT_EQ(std::set(adopted.cbegin(), adopted.cend()).size(), adopted.size());
+        EXPECT_TRUE(FreeBlocks(allocator, adopted, 5000));
+    }}.join();
+
+    EXPECT_EQ(upstream.Allocations(), slabs);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <Helena/Types/EntityRegistry.hpp>
+
+#include <cstddef>
+#include <vector>
+
+using Helena::Types::DefaultAllocator;
+using Helena::Types::Entity;
+using Helena::Types::IMemoryResource;
+
+namespace {
+    struct Position {
+        float x, y;
+    };
+
+    class CountingResource final : public IMemoryResource
+    {
+    public:
+        std::size_t m_Allocations{};
+        std::size_t m_Frees{};
+
+    protected:
+        void* Allocate(std::size_t bytes, std::size_t alignment) override {
+            ++m_Allocations;
+            return DefaultAllocator::Get()->AllocateMemory(bytes, alignment);
+        }
+
+        void Free(void* ptr, std::size_t bytes, std::size_t alignment) override {
+            ++m_Frees;
+            DefaultAllocator::Get()->FreeMemory(ptr, bytes, alignment);
+        }
+
+        bool Equal(const IMemoryResource& other) const override {
+            return this == &other;
+        }
+    };
+
+    struct ClearKey {};
+    struct ResourceKey {};
+}
+
+TEST(EntityRegistry, ClearInvalidatesHandles)
+{
+    Helena::Types::EntityRegistry<ClearKey> registry;
+
+    std::vector<Entity> entities;
+    for(int i = 0; i < 16; ++i) {
+        entities.push_back(registry.Create());
+        registry.Emplace<Position>(entities.back(), 1.f, 2.f);
+    }
+
+    registry.Destroy(entities[3]);
+    registry.Clear();
+    EXPECT_EQ(registry.Alive(), 0u);
+
+    for(const auto entity : entities) {
+        EXPECT_FALSE(registry.Valid(entity));
+    }
+
+    // The indexes are reused with the next version, old handles stay invalid
+    for(std::size_t i = 0; i < entities.size(); ++i)
+    {
+        const auto entity = registry.Create();
+        EXPECT_LT(entity.m_Index, entities.size());
+        EXPECT_NE(entity.m_Version, entities[entity.m_Index].m_Version);
+        EXPECT_FALSE(registry.Has<Position>(entity));
+    }
+
+    EXPECT_EQ(registry.Alive(), entities.size());
+    for(const auto entity : entities) {
+        EXPECT_FALSE(registry.Valid(entity));
+    }
+}
+
+TEST(EntityRegistry, PoolsUseTheResource)
+{
+    CountingResource resource;
+    {
+        Helena::Types::EntityRegistry<ResourceKey> registry;
+        registry.SetResource(&resource);
+        EXPECT_EQ(registry.GetResource(), &resource);
+
+        for(int i = 0; i < 64; ++i) {
+            registry.Emplace<Position>(registry.Create(), 0.f, 0.f);
+        }
+
+        EXPECT_GT(resource.m_Allocations, 0u);
+    }
+
+    EXPECT_EQ(resource.m_Allocations, resource.m_Frees);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <Helena/Types/JobSystem.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using Helena::Types::JobSystem;
+
+TEST(JobSystem, RunsInlineWhenNotStarted)
+{
+    JobSystem jobs;
+    int value{};
+
+    const auto job = jobs.Run([&value]{ value = 42; });
+    EXPECT_EQ(value, 42);
+    EXPECT_TRUE(JobSystem::Finished(job));
+}
+
+TEST(JobSystem, ParentWaitsForChildren)
+{
+    JobSystem jobs;
+    jobs.Start(3);
+
+    std::atomic<int> children{};
+    std::atomic<int> grandchildren{};
+    const auto root = jobs.Create([]{});
+
+    for(int i = 0; i < 256; ++i) {
+        jobs.Run([&jobs, &children, &grandchildren, root]{
+            ++children;
+            for(int j = 0; j < 4; ++j) {
+                jobs.Run([&grandchildren]{ ++grandchildren; }, root);
+            }
+        }, root);
+    }
+
+    jobs.Schedule(root);
+    jobs.WaitFor(root);
+
+    EXPECT_TRUE(JobSystem::Finished(root));
+    EXPECT_EQ(children.load(), 256);
+    EXPECT_EQ(grandchildren.load(), 1024);
+    jobs.Stop();
+}
+
+TEST(JobSystem, WaitForFromForeignThread)
+{
+    JobSystem jobs;
+    jobs.Start(2);
+
+    std::atomic<int> counter{};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; ++t) {
+        threads.emplace_back([&jobs, &counter]{
+            const auto root = jobs.Create([]{});
+            for(int i = 0; i < 1000; ++i) {
+                jobs.Run([&counter]{ ++counter; }, root);
+            }
+
+            jobs.Schedule(root);
+            jobs.WaitFor(root);
+            EXPECT_TRUE(JobSystem::Finished(root));
+        });
+    }
+
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.load(), 4000);
+    jobs.Stop();
+}
+
+TEST(JobSystem, RingGrowsWhenAllJobsAreLive)
+{
+    JobSystem jobs;
+    jobs.Start(2);
+
+    // More live jobs than a ring holds: the jobs are created before any is scheduled
+    constexpr int count = 10000;
+    std::atomic<int> counter{};
+    const auto root = jobs.Create([]{});
+    std::vector<JobSystem::Job*> handles;
+    for(int i = 0; i < count; ++i) {
+        handles.push_back(jobs.Create([&counter]{ ++counter; }, root));
+    }
+
+    for(std::size_t i = 1; i < handles.size(); ++i) {
+        ASSERT_NE(handles[i - 1], handles[i]);
+        ASSERT_FALSE(JobSystem::Finished(handles[i]));
+    }
+
+    for(const auto job : handles) {
+        jobs.Schedule(job);
+    }
+
+    jobs.Schedule(root);
+    jobs.WaitFor(root);
+
+    EXPECT_EQ(counter.load(), count);
+    jobs.Stop();
+}
+
+TEST(JobSystem, StopExecutesPendingJobs)
+{
+    JobSystem jobs;
+    jobs.Start(2);
+
+    std::atomic<int> counter{};
+    for(int i = 0; i < 1000; ++i) {
+        jobs.Run([&counter]{ ++counter; });
+    }
+
+    jobs.Stop();
+    EXPECT_FALSE(jobs.Running());
+    EXPECT_EQ(counter.load(), 1000);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <Helena/Types/Allocators.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+using Helena::Types::PoolAllocator;
+
+TEST(PoolAllocator, GrowsPastTheFirstSlab)
+{
+    PoolAllocator<32, 16, 4> allocator;
+
+    // Slabs of 4, 8 and 16 blocks
+    std::vector<void*> blocks;
+    for(int i = 0; i < 28; ++i)
+    {
+        const auto block = allocator.AllocateMemory(32, 16);
+        ASSERT_NE(block, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % 16, 0u);
+        std::fill_n(static_cast<std::byte*>(block), 32, std::byte{0xAB});
+        blocks.push_back(block);
+    }
+
+    EXPECT_EQ(allocator.Slabs(), 3u);
+    EXPECT_EQ(allocator.Capacity(), 28u);
+    EXPECT_EQ(std::set<void*>(blocks.cbegin(), blocks.cend()).size(), blocks.size());
+
+    // The blocks of all slabs are returned to the free list and reused without growth
+    for(const auto block : blocks) {
+        allocator.FreeMemory(block, 32, 16);
+    }
+
+    for(int i = 0; i < 28; ++i) {
+        blocks[i] = allocator.AllocateMemory(32, 16);
+    }
+
+    EXPECT_EQ(allocator.Slabs(), 3u);
+    EXPECT_EQ(std::set<void*>(blocks.cbegin(), blocks.cend()).size(), blocks.size());
+
+    for(const auto block : blocks) {
+        allocator.FreeMemory(block, 32, 16);
+    }
+}
+
+TEST(PoolAllocator, Statistics)
+{
+    PoolAllocator<64, alignof(std::max_align_t), 16> allocator;
+    EXPECT_EQ(allocator.Capacity(), 0u);
+    EXPECT_EQ(allocator.Used(), 0u);
+    EXPECT_EQ(allocator.Available(), 0u);
+
+    allocator.Reserve(40);
+    EXPECT_EQ(allocator.Capacity(), 48u);
+    EXPECT_EQ(allocator.Used(), 0u);
+    EXPECT_EQ(allocator.Available(), 48u);
+
+    std::vector<void*> blocks;
+    for(int i = 0; i < 10; ++i) {
+        blocks.push_back(allocator.AllocateMemory(64));
+    }
+
+    EXPECT_EQ(allocator.Used(), 10u);
+    EXPECT_EQ(allocator.Available(), 38u);
+
+    // Larger blocks are allocated from the upstream resource and are not counted
+    const auto large = allocator.AllocateMemory(128);
+    EXPECT_EQ(allocator.Used(), 10u);
+    allocator.FreeMemory(large, 128);
+
+    for(const auto block : blocks) {
+        allocator.FreeMemory(block, 64);
+    }
+
+    EXPECT_EQ(allocator.Used(), 0u);
+    EXPECT_EQ(allocator.Available(), allocator.Capacity());
+}
+
+TEST(PoolAllocator, ConcurrentPopPush)
+{
+    // A few blocks shared by many threads: the same head is popped and pushed back
+    // between the load and the compare of other threads (ABA)
+    PoolAllocator<sizeof(std::uint64_t), alignof(std::uint64_t), 4> allocator;
+    allocator.Reserve(4);
+
+    constexpr std::uint64_t threads = 8;
+    constexpr int iterations = 20000;
+    std::atomic<bool> corrupted{};
+    std::vector<std::thread> workers;
+    for(std::uint64_t thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back([&allocator, &corrupted, thread]
+        {
+            for(int i = 0; i < iterations; ++i)
+            {
+                const auto first = static_cast<std::uint64_t*>(allocator.AllocateMemory(sizeof(std::uint64_t), alignof(std::uint64_t)));
+                const auto second = static_cast<std::uint64_t*>(allocator.AllocateMemory(sizeof(std::uint64_t), alignof(std::uint64_t)));
+                *first = thread;
+                *second = thread + threads;
+                std::this_thread::yield();
+
+                // The block given to two threads at once is overwritten by the other thread
+                if(first == second || *first != thread || *second != thread + threads) {
+                    corrupted.store(true, std::memory_order_relaxed);
+                }
+
+                allocator.FreeMemory(second, sizeof(std::uint64_t), alignof(std::uint64_t));
+                allocator.FreeMemory(first, sizeof(std::uint64_t), alignof(std::uint64_t));
+            }
+        });
+    }
+
+    for(auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_FALSE(corrupted.load());
+    EXPECT_EQ(allocator.Used(), 0u);
+
+    // The free list holds every block once: all blocks are popped without growth
+    const auto capacity = allocator.Capacity();
+    const auto slabs = allocator.Slabs();
+    std::set<void*> blocks;
+    for(std::size_t i = 0; i < capacity; ++i) {
+        blocks.insert(allocator.AllocateMemory(sizeof(std::uint64_t), alignof(std::uint64_t)));
+    }
+
+    EXPECT_EQ(blocks.size(), capacity);
+    EXPECT_EQ(allocator.Slabs(), slabs);
+    EXPECT_EQ(allocator.Available(), 0u);
+
+    for(const auto block : blocks) {
+        allocator.FreeMemory(block, sizeof(std::uint64_t), alignof(std::uint64_t));
+    }
+}